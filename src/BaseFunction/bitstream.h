@@ -0,0 +1,172 @@
+/* Bit stream reader/writer for binary message decoding/encoding ----------------------------------
+* bitstr_t : sequential reader of big-endian bit fields (rtcm, sbas, cmr, ...)
+*            loads input into a 64-bit word and extracts fields by shift/mask
+* bitwr_t  : sequential writer of big-endian bit fields (rtcm encoder)
+*            collects fields in a 64-bit word and stores whole bytes
+*
+* fields are read only from the bytes inside the buffer (never beyond len bytes),
+* bits after the end of buffer are read as 0
+--------------------------------------------------------------------------------------------------- */
+#ifndef BITSTREAM_H
+#define BITSTREAM_H
+
+#include "hprtk_lib.h"
+#include <cstring>
+
+/* bit stream reader ------------------------------------------------------------------------------ */
+class bitstr_t{
+	/* Constructor */
+	public:
+		bitstr_t(const unsigned char *Buff,int Len,int BitPos=0) {
+			buff=Buff; nbyte=Len; seek(BitPos);
+		}
+	/* Implementation functions */
+	public:
+		/* extract unsigned bits at bit position (len<=32) ------------------------ */
+		static unsigned int getu(const unsigned char *Buff,int BitPos,int BitLen) {
+			const unsigned char *p=Buff+(BitPos>>3);
+			int off=BitPos&7,nb=(off+BitLen+7)>>3;
+			unsigned long long w=0;
+			if (BitLen<=0) return 0;
+			for (int i=0; i<nb; i++) w=(w<<8)|p[i];
+			w>>=nb*8-off-BitLen;
+			return (unsigned int)(w&(~0ULL>>(64-BitLen)));
+		}
+		/* extract signed bits at bit position (len<=32) -------------------------- */
+		static int gets(const unsigned char *Buff,int BitPos,int BitLen) {
+			unsigned int u=getu(Buff,BitPos,BitLen);
+			if (BitLen<=0||32<=BitLen||!(u&(1u<<(BitLen-1)))) return (int)u;
+			return (int)(u|(~0u<<BitLen)); /* extend sign */
+		}
+		/* read unsigned bits and advance (len<=32) ------------------------------- */
+		unsigned int getu(int BitLen) {
+			unsigned int u;
+			if (BitLen<=0) return 0;
+			if (nc<BitLen) fill();
+			u=(unsigned int)(cache>>(64-BitLen));
+			cache<<=BitLen; nc-=BitLen; pos+=BitLen;
+			return u;
+		}
+		/* read signed bits and advance (len<=32) --------------------------------- */
+		int gets(int BitLen) {
+			unsigned int u=getu(BitLen);
+			if (BitLen<=0||32<=BitLen||!(u&(1u<<(BitLen-1)))) return (int)u;
+			return (int)(u|(~0u<<BitLen));
+		}
+		/* read signed 38 bits and advance ---------------------------------------- */
+		double gets38() {
+			double d=(double)gets(32)*64.0;
+			return d+getu(6);
+		}
+		/* skip bits -------------------------------------------------------------- */
+		void skip(int BitLen) {
+			if (BitLen<=nc) { cache=BitLen<64 ? cache<<BitLen : 0; nc-=BitLen; pos+=BitLen; }
+			else seek(pos+BitLen);
+		}
+		/* move to bit position --------------------------------------------------- */
+		void seek(int BitPos) {
+			pos=BitPos; next=BitPos>>3; cache=0; nc=0;
+			fill();
+			if (BitPos&7) { cache<<=BitPos&7; nc-=BitPos&7; }
+		}
+		/* current bit position --------------------------------------------------- */
+		int tell() const { return pos; }
+		/* number of bits left in buffer ------------------------------------------ */
+		int left() const { return nbyte*8-pos; }
+	protected:
+		/* load 64-bit big-endian word -------------------------------------------- */
+		static unsigned long long load64(const unsigned char *p) {
+			unsigned long long w;
+#if defined(__GNUC__)&&defined(__BYTE_ORDER__)&&__BYTE_ORDER__==__ORDER_LITTLE_ENDIAN__
+			memcpy(&w,p,8);
+			return __builtin_bswap64(w);
+#else
+			w=0;
+			for (int i=0; i<8; i++) w=(w<<8)|p[i];
+			return w;
+#endif
+		}
+		/* load bytes into cache word (at least 57 bits) -------------------------- */
+		void fill() {
+			if (next+8<=nbyte) { /* whole word inside buffer */
+				int k=(64-nc)>>3;
+				cache|=(load64(buff+next)>>nc)&(~0ULL<<(64-nc-8*k));
+				next+=k; nc+=8*k;
+				return;
+			}
+			while (nc<=56) {
+				if (next<nbyte) cache|=(unsigned long long)buff[next]<<(56-nc);
+				next++; nc+=8;
+			}
+		}
+	/* Components */
+	protected:
+		const unsigned char *buff;		/* byte data */
+		int nbyte;						/* length of byte data (bytes) */
+		int pos;						/* current bit position */
+		int next;						/* next byte to load into cache */
+		int nc;							/* number of valid bits in cache */
+		unsigned long long cache;		/* cached bits (msb aligned) */
+};
+
+/* bit stream writer ------------------------------------------------------------------------------
+* bits before BitPos in the first byte are kept, call flush() after the last field */
+class bitwr_t{
+	/* Constructor */
+	public:
+		bitwr_t(unsigned char *Buff,int BitPos=0) {
+			buff=Buff; pos=BitPos; next=BitPos>>3; nc=BitPos&7;
+			cache=nc ? (unsigned long long)(buff[next]>>(8-nc))<<(64-nc) : 0;
+		}
+	/* Implementation functions */
+	public:
+		/* write unsigned bits and advance (len<=32) ------------------------------ */
+		void setu(int BitLen,unsigned int Data) {
+			if (BitLen<=0) return;
+			if (BitLen<32) Data&=(1u<<BitLen)-1;
+			if (nc+BitLen>64) store();
+			cache|=(unsigned long long)Data<<(64-nc-BitLen);
+			nc+=BitLen; pos+=BitLen;
+		}
+		/* write signed bits and advance (len<=32) -------------------------------- */
+		void sets(int BitLen,int Data) {
+			setu(BitLen,(unsigned int)Data);
+		}
+		/* write signed 38 bits and advance --------------------------------------- */
+		void sets38(double Data) {
+			double h=floor(Data/64.0);
+			sets(32,(int)h);
+			setu(6,(unsigned int)(Data-h*64.0));
+		}
+		/* write sign-magnitude bits and advance (len<=32) ------------------------ */
+		void setg(int BitLen,double Data) {
+			setu(1,Data<0.0 ? 1 : 0);
+			setu(BitLen-1,(unsigned int)floor(fabs(Data)+0.5));
+		}
+		/* write zero bits -------------------------------------------------------- */
+		void skip(int BitLen) {
+			for (; BitLen>32; BitLen-=32) setu(32,0);
+			setu(BitLen,0);
+		}
+		/* store cached bits to buffer (last byte padded with 0) ------------------ */
+		void flush() {
+			store();
+			if (nc>0) { buff[next]=(unsigned char)(cache>>56); cache=0; nc=0; next++; }
+		}
+		/* current bit position --------------------------------------------------- */
+		int tell() const { return pos; }
+	protected:
+		/* store whole bytes of cache --------------------------------------------- */
+		void store() {
+			for (; nc>=8; nc-=8) { buff[next++]=(unsigned char)(cache>>56); cache<<=8; }
+		}
+	/* Components */
+	protected:
+		unsigned char *buff;			/* byte data */
+		int pos;						/* current bit position */
+		int next;						/* next byte to store from cache */
+		int nc;							/* number of valid bits in cache */
+		unsigned long long cache;		/* cached bits (msb aligned) */
+};
+
+#endif
@@ -0,0 +1,97 @@
+/* Bounded lock-free queues for pipelined rtk server ----------------------------------------------
+* single-producer/single-consumer queues, one thread writes and one thread reads
+* (head is only written by consumer, tail is only written by producer)
+*
+* spscq_t<T>  : queue of elements (epoch tokens, solution messages)
+* ringbuf_t   : queue of bytes (raw/rtcm data from input streams)
+--------------------------------------------------------------------------------------------------- */
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "hprtk_lib.h"
+#include <atomic>
+
+/* single-producer/single-consumer element queue -------------------------------------------------- */
+template <class T>
+class spscq_t{
+	/* Constructor */
+	public:
+		spscq_t() { head=tail=0; size=0; }
+		~spscq_t() { data.clear(); }
+	/* Implementation functions */
+	public:
+		/* initialize queue with capacity (not thread safe) ----------------------- */
+		void init(unsigned int capacity) {
+			size=capacity+1; data.assign(size,T());
+			head.store(0); tail.store(0);
+		}
+		/* push element (producer), return 0 if queue is full --------------------- */
+		int push(const T &elem) {
+			unsigned int t=tail.load(std::memory_order_relaxed),next=(t+1)%size;
+			if (size==0||next==head.load(std::memory_order_acquire)) return 0;
+			data[t]=elem;
+			tail.store(next,std::memory_order_release);
+			return 1;
+		}
+		/* pop element (consumer), return 0 if queue is empty --------------------- */
+		int pop(T &elem) {
+			unsigned int h=head.load(std::memory_order_relaxed);
+			if (h==tail.load(std::memory_order_acquire)) return 0;
+			elem=data[h];
+			head.store((h+1)%size,std::memory_order_release);
+			return 1;
+		}
+		/* test empty queue ------------------------------------------------------- */
+		int empty() const {
+			return head.load(std::memory_order_acquire)==tail.load(std::memory_order_acquire);
+		}
+	/* Components */
+	protected:
+		unsigned int size;				/* size of data (capacity+1) */
+		vector<T> data;					/* element buffer */
+		std::atomic<unsigned int> head;	/* read index (consumer) */
+		std::atomic<unsigned int> tail;	/* write index (producer) */
+};
+
+/* single-producer/single-consumer byte queue ----------------------------------------------------- */
+class ringbuf_t{
+	/* Constructor */
+	public:
+		ringbuf_t() { head=tail=0; size=0; }
+		~ringbuf_t() { data.clear(); }
+	/* Implementation functions */
+	public:
+		/* initialize queue with capacity (not thread safe) ----------------------- */
+		void init(unsigned int capacity) {
+			size=capacity+1; data.assign(size,0);
+			head.store(0); tail.store(0);
+		}
+		/* write bytes (producer), return number of written bytes ----------------- */
+		int write(const unsigned char *buff,int n) {
+			unsigned int t=tail.load(std::memory_order_relaxed);
+			unsigned int h=head.load(std::memory_order_acquire);
+			int nfree=size==0 ? 0 : (int)((h+size-t-1)%size),i;
+			if (n>nfree) n=nfree;
+			for (i=0; i<n; i++) data[(t+i)%size]=buff[i];
+			tail.store((t+n)%size,std::memory_order_release);
+			return n;
+		}
+		/* read bytes (consumer), return number of read bytes --------------------- */
+		int read(unsigned char *buff,int n) {
+			unsigned int h=head.load(std::memory_order_relaxed);
+			unsigned int t=tail.load(std::memory_order_acquire);
+			int nused=size==0 ? 0 : (int)((t+size-h)%size),i;
+			if (n>nused) n=nused;
+			for (i=0; i<n; i++) buff[i]=data[(h+i)%size];
+			head.store((h+n)%size,std::memory_order_release);
+			return n;
+		}
+	/* Components */
+	protected:
+		unsigned int size;				/* size of data (capacity+1) */
+		vector<unsigned char> data;		/* byte buffer */
+		std::atomic<unsigned int> head;	/* read index (consumer) */
+		std::atomic<unsigned int> tail;	/* write index (producer) */
+};
+
+#endif
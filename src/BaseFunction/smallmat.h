@@ -0,0 +1,135 @@
+/* Fixed-size small vector and matrix types -------------------------------------------------------
+* vecf_t<N>   : vector of N elements
+* matf_t<R,C> : matrix of R rows and C columns, column-major order (same as matmul)
+*               element (i,j) at m[i+j*R]
+*
+* sizes are compile-time constants, so loops are unrolled and kept in registers.
+* used for 3x3/6x6 geometry (ecef/enu, satellite frames, earth tides) instead of
+* runtime-size loops on double*
+--------------------------------------------------------------------------------------------------- */
+#ifndef SMALLMAT_H
+#define SMALLMAT_H
+
+#include "hprtk_lib.h"
+
+/* fixed-size vector ------------------------------------------------------------------------------ */
+template <int N>
+class vecf_t{
+	/* Constructor */
+	public:
+		vecf_t() {}
+		vecf_t(double x,double y,double z) { v[0]=x; v[1]=y; v[2]=z; }
+		template <typename Iter>
+		explicit vecf_t(const Iter a) { for (int i=0; i<N; i++) v[i]=a[i]; }
+	/* Implementation functions */
+	public:
+		double &operator[](int i) { return v[i]; }
+		const double &operator[](int i) const { return v[i]; }
+		/* copy to double pointer or vector iterator ------------------------------ */
+		template <typename Iter>
+		void copyto(Iter a) const { for (int i=0; i<N; i++) a[i]=v[i]; }
+	/* Components */
+	public:
+		double v[N];
+};
+/* fixed-size matrix (column-major) --------------------------------------------------------------- */
+template <int R,int C>
+class matf_t{
+	/* Constructor */
+	public:
+		matf_t() {}
+		template <typename Iter>
+		explicit matf_t(const Iter a) { for (int i=0; i<R*C; i++) m[i]=a[i]; }
+	/* Implementation functions */
+	public:
+		double &operator[](int i) { return m[i]; }
+		const double &operator[](int i) const { return m[i]; }
+		double &operator()(int i,int j) { return m[i+j*R]; }
+		const double &operator()(int i,int j) const { return m[i+j*R]; }
+		/* copy to double pointer or vector iterator ------------------------------ */
+		template <typename Iter>
+		void copyto(Iter a) const { for (int i=0; i<R*C; i++) a[i]=m[i]; }
+	/* Components */
+	public:
+		double m[R*C];
+};
+
+typedef vecf_t<3>   vec3_t;
+typedef matf_t<3,3> mat3_t;
+typedef matf_t<6,6> mat6_t;
+
+/* vector operations ------------------------------------------------------------------------------ */
+template <int N>
+inline vecf_t<N> operator+(const vecf_t<N> &a,const vecf_t<N> &b){
+	vecf_t<N> c; for (int i=0; i<N; i++) c.v[i]=a.v[i]+b.v[i]; return c;
+}
+template <int N>
+inline vecf_t<N> operator-(const vecf_t<N> &a,const vecf_t<N> &b){
+	vecf_t<N> c; for (int i=0; i<N; i++) c.v[i]=a.v[i]-b.v[i]; return c;
+}
+template <int N>
+inline vecf_t<N> operator-(const vecf_t<N> &a){
+	vecf_t<N> c; for (int i=0; i<N; i++) c.v[i]=-a.v[i]; return c;
+}
+template <int N>
+inline vecf_t<N> operator*(double s,const vecf_t<N> &a){
+	vecf_t<N> c; for (int i=0; i<N; i++) c.v[i]=s*a.v[i]; return c;
+}
+/* inner product ---------------------------------------------------------------------------------- */
+template <int N>
+inline double dot(const vecf_t<N> &a,const vecf_t<N> &b){
+	double d=0.0; for (int i=0; i<N; i++) d+=a.v[i]*b.v[i]; return d;
+}
+/* euclid norm ------------------------------------------------------------------------------------ */
+template <int N>
+inline double norm(const vecf_t<N> &a){
+	return sqrt(dot(a,a));
+}
+/* outer product of 3d vectors -------------------------------------------------------------------- */
+inline vec3_t cross(const vec3_t &a,const vec3_t &b){
+	return vec3_t(a.v[1]*b.v[2]-a.v[2]*b.v[1],a.v[2]*b.v[0]-a.v[0]*b.v[2],
+		a.v[0]*b.v[1]-a.v[1]*b.v[0]);
+}
+/* normalize vector (return 0 if zero vector) ----------------------------------------------------- */
+template <int N>
+inline int normv(const vecf_t<N> &a,vecf_t<N> &b){
+	double r;
+	if ((r=norm(a))<=0.0) return 0;
+	for (int i=0; i<N; i++) b.v[i]=a.v[i]/r;
+	return 1;
+}
+
+/* matrix operations ------------------------------------------------------------------------------ */
+/* A*x -------------------------------------------------------------------------------------------- */
+template <int R,int C>
+inline vecf_t<R> operator*(const matf_t<R,C> &A,const vecf_t<C> &x){
+	vecf_t<R> y;
+	for (int i=0; i<R; i++) { y.v[i]=0.0; for (int j=0; j<C; j++) y.v[i]+=A.m[i+j*R]*x.v[j]; }
+	return y;
+}
+/* A'*x ------------------------------------------------------------------------------------------- */
+template <int R,int C>
+inline vecf_t<C> tmul(const matf_t<R,C> &A,const vecf_t<R> &x){
+	vecf_t<C> y;
+	for (int j=0; j<C; j++) { y.v[j]=0.0; for (int i=0; i<R; i++) y.v[j]+=A.m[i+j*R]*x.v[i]; }
+	return y;
+}
+/* A*B -------------------------------------------------------------------------------------------- */
+template <int R,int K,int C>
+inline matf_t<R,C> operator*(const matf_t<R,K> &A,const matf_t<K,C> &B){
+	matf_t<R,C> D;
+	for (int j=0; j<C; j++) for (int i=0; i<R; i++) {
+		D.m[i+j*R]=0.0;
+		for (int k=0; k<K; k++) D.m[i+j*R]+=A.m[i+k*R]*B.m[k+j*K];
+	}
+	return D;
+}
+/* A' --------------------------------------------------------------------------------------------- */
+template <int R,int C>
+inline matf_t<C,R> trans(const matf_t<R,C> &A){
+	matf_t<C,R> B;
+	for (int j=0; j<C; j++) for (int i=0; i<R; i++) B.m[j+i*C]=A.m[i+j*R];
+	return B;
+}
+
+#endif
@@ -5,24 +5,26 @@
 
 #include "hprtk_lib.h"
 
-/* time structure --------------------------------------------------------------------------------- */
+/* time structure -----------------------------------------------------------------------------------
+* compact time value (time_t+fraction, 16 bytes), trivially copyable
+* calendar day/time and string format are computed only by time2epoch()/time2str()
+--------------------------------------------------------------------------------------------------- */
 class gtime_t{
 	/* Constructors */
 	public:
 		gtime_t();
 		/* initialize with epoch array -------------------------------------------- */
 		gtime_t(const double *epoch);
-		~gtime_t();
 	public:
 	/* implementation function */
 		/* string to time --------------------------------------------------------- */
 		int str2time(string s);
 		/* ep time to string ------------------------------------------------------ */
-		string time2str(int n);
+		string time2str(int n) const;
 		/* calender day/time (ep) to time ----------------------------------------- */
 		gtime_t *epoch2time(const double *inep);
 		/* time to calender day/time (ep) ----------------------------------------- */
-		void time2epoch();
+		void time2epoch(double *ep) const;
 		/* gps week time to time -------------------------------------------------- */
 		gtime_t *gpst2time(int week, double sss);
 		/* time to gps week tme --------------------------------------------------- */
@@ -52,13 +54,13 @@ class gtime_t{
 		/* Beidou time to gps time ------------------------------------------------ */
 		gtime_t *bdt2gpst();
 		/* time to day and sec ---------------------------------------------------- */
-		double time2sec(gtime_t &day);
+		double time2sec(gtime_t &day) const;
 		/* utc to Greenwich mean sidereal time ------------------------------------ */
 		double utc2gmst(double ut1_utc);
 		/* day of year to time ---------------------------------------------------- */
 		int doy2time(int year,int doy);
 		/* time to day of year ---------------------------------------------------- */
-		double time2doy();
+		double time2doy() const;
 		/* read leap seconds table ------------------------------------------------ */
 		int read_leaps(const string file);
 		/* adjust time considering week handover ---------------------------------- */
@@ -80,10 +82,6 @@ class gtime_t{
 	public:
 		time_t time;					/* time (s) expressed by standard time_t */
 		double sec;						/* fraction of second under 1 s */
-		double ep[6];					/* {year,month,day,hour,min,sec} */
-		string sep;						/* ep in string format */
-		int doy;						/* day of year */
-		int sys;						/* time system */
 };
 
 #endif
\ No newline at end of file
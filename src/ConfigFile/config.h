@@ -32,6 +32,7 @@ class pstopt_t {
 		int predict;					/* flag of use predicted data */
 		double time_inter;				/* time interval (s) */
 		gtime_t time_start,time_end;	/* start and end time */
+		string tstart,tend;				/* start and end time string (yyyy mm dd hh mm ss) */
 		string rover_obs;				/* rover observation file */
 		string base_obs;				/* base observation file */
 		string nav;						/* navigation file */
@@ -49,11 +50,12 @@ class rtkopt_t{
 		~rtkopt_t();
 	/* Components */  
 	public:
-		int strtype[8];					/* stream types */
-		string strpath[8];				/* stream paths */
+		int strtype[MAXSTRRTK];			/* stream types */
+		string strpath[MAXSTRRTK];		/* stream paths */
 		int strfmt[3];					/* stream formats */
 
 		int svrcycle;					/* server cycle (ms) */
+		int svrwait;					/* max wait for stream input (ms) (timer of file replay) */
 		int timeout;					/* timeout time (ms) */
 		int reconnect;					/* reconnect interval (ms) */
 		int nmeacycle;					/* nmea request cycle (ms) */
@@ -63,6 +65,11 @@ class rtkopt_t{
 		int nmeareq;					/* nmea request type (0:off,1:lat/lon,2:single) */
 		double nmeapos[3];				/* nmea position (lat/lon) (deg) */
 		string proxyaddr;				/* proxy address (1024) */
+		string roverlist;				/* rover list file (multi-rover server, ""=off) */
+		int nworker;					/* number of positioning threads (multi-rover server) */
+		int svrmode;					/* server mode (0:cycle,1:pipeline) */
+		string relaymsg;				/* rtcm3 message types relayed from base (outstr3) */
+		int relaystaid;					/* station id of relay if base stream is not rtcm */
 
 		/* unset options */
 		string cmds[3];					/* stream start commands (256) */
@@ -135,6 +142,7 @@ class prcopt_t{
 		double elmaskhold;				/* elevation mask to hold ambiguity (deg) */
 		double maxtdiff;				/* max difference of time (sec) */
 		double maxres;					/* max residual of code in SPP */
+		double maxinno;					/* max innovation of sequential kalman (sigma) (0:off) */
 		double baseline[2];				/* baseline length constraint {const,sigma} (m) */
 
 		string name[2];					/* rover and base name */
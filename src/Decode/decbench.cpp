@@ -0,0 +1,800 @@
+/* Decoder throughput benchmark with synthetic stream generator -----------------------------------
+* streams of each format and message type are generated from one simulated constellation, so a
+* regression in a decode path is visible without receiver logs:
+*   RTCM2 3/18/19, RTCM3 1004/1012/1006/msm4-7/ephemerides/ssr, UBX RXM-RAWX, SBF MeasEpoch,
+*   JAVAD [RD]/[~~]/[SI]/[RC]
+* observables are geometric range plus constant signal bias and integer ambiguity (no atmosphere,
+* no clock, no noise), ephemerides are exact for the simulated circular orbits
+--------------------------------------------------------------------------------------------------- */
+#include "Decode/decbench.h"
+#include "BaseFunction/basefunction.h"
+#include "Decode/rawlog.h"
+#include "Decode/raw/javad.h"
+#include "Decode/raw/septentrio.h"
+#include "Decode/raw/ublox.h"
+
+/* constant --------------------------------------------------------------------------------------- */
+#define MU_SIM      3.9860050E14		/* gravitational constant of simulated orbits */
+#define ELMIN_SIM   (10.0*D2R)			/* elevation mask of simulation (rad) */
+#define TOEINT_EPH  7200.0				/* update interval of ephemeris (s) */
+#define TOEINT_GLO  1800.0				/* update interval of glonass ephemeris (s) */
+#define RTCM2PREAMB 0x66				/* rtcm ver.2 frame preamble */
+#define ID_MEASEPOCH 4027				/* sbf block id of measepoch */
+#define TINT_JAVAD  30.0				/* interval of javad log (s) */
+#define ROT_LEFT(val) ((unsigned char)(((val)<<2)|((val)>>6)))
+
+/* simulated constellations ----------------------------------------------------------------------- */
+static const struct {
+	int sys,prn0,nsat,nplane;			/* system, first prn, satellites, orbit planes */
+	double a,inc;						/* semi-major axis (m), inclination (deg) */
+	unsigned char code[NSIGSIM];		/* observation codes */
+	int ubxid;							/* ubx gnss id */
+	int sbfsig[NSIGSIM];				/* sbf signal types */
+} simsys[]={
+	{SYS_GPS,        1,32,6,26559710.0,55.0,{CODE_L1C,CODE_L2W,CODE_L5Q},0,{ 0, 2, 4}},
+	{SYS_GLO,MINPRNGLO,24,3,25508200.0,64.8,{CODE_L1C,CODE_L2P,0       },6,{ 8,10,-1}},
+	{SYS_GAL,        1,30,3,29599800.0,56.0,{CODE_L1C,CODE_L5Q,CODE_L7Q},2,{17,20,21}},
+	{SYS_CMP,       19,22,3,27906100.0,55.0,{CODE_L2I,CODE_L7I,CODE_L6I},3,{28,29,30}}
+};
+#define NSIMSYS     ((int)(sizeof(simsys)/sizeof(simsys[0])))
+
+/* index of simulated system ---------------------------------------------------------------------- */
+static int sysindex(int sys){
+	for (int i=0; i<NSIMSYS; i++) if (simsys[i].sys==sys) return i;
+	return -1;
+}
+/* integer ambiguity of simulated signal (cycles) ------------------------------------------------- */
+static double simamb(int sat,int freq){
+	return (double)((sat*37+freq*11)%200-100);
+}
+/* glonass frequency channel number of slot ------------------------------------------------------- */
+static int simfcn(int slot){
+	return (slot-1)%14-7;
+}
+/* carrier frequency of sbf signal type (Hz) ------------------------------------------------------ */
+static double sbffreq(int sig,int fcn){
+	switch (sig) {
+		case  0: return FREQ1;
+		case  2: return FREQ2;
+		case  4: return FREQ5;
+		case  8: return FREQ1_GLO+DFRQ1_GLO*fcn;
+		case 10: return FREQ2_GLO+DFRQ2_GLO*fcn;
+		case 17: return FREQ1;
+		case 20: return FREQ5;
+		case 21: return FREQ7;
+		case 28: return FREQ1_CMP;
+		case 29: return FREQ2_CMP;
+		case 30: return FREQ3_CMP;
+	}
+	return FREQ1;
+}
+/* set little-endian fields ----------------------------------------------------------------------- */
+static void setU2(unsigned char *p,unsigned short u) { memcpy(p,&u,2); }
+static void setU4(unsigned char *p,unsigned int   u) { memcpy(p,&u,4); }
+static void setI4(unsigned char *p,int            i) { memcpy(p,&i,4); }
+static void setR4(unsigned char *p,float          r) { memcpy(p,&r,4); }
+static void setR8(unsigned char *p,double         r) { memcpy(p,&r,8); }
+
+/* synthetic constellation and stream generator ------------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+streamgen_t::streamgen_t(){
+	tint=1.0; word=0; seqno=0;
+	for (int i=0; i<3; i++) rr[i]=pos[i]=0.0;
+	for (int i=0; i<MAXSAT; i++) {
+		orb[i][0]=orb[i][1]=orb[i][2]=orb[i][3]=0.0;
+		rng[i]=elev[i]=rate[i]=0.0;
+		loss[i]=0;
+	}
+	ssr=new ssr_t[MAXSAT];
+	enc=new rtcm3e_t;
+}
+streamgen_t::~streamgen_t(){
+	delete [] ssr;
+	delete enc;
+}
+/* satellite position of circular orbit (ecef) ---------------------------------------------------- */
+void streamgen_t::satpos(int sat,gtime_t t,double *rs) const{
+	const double *o=orb[sat-1];
+	double dt=t.timediff(tref),u,omg,x,y,ci=cos(o[1]);
+
+	u=o[3]+sqrt(MU_SIM/(o[0]*o[0]*o[0]))*dt;
+	omg=o[2]-OMGE*dt;
+	x=o[0]*cos(u); y=o[0]*sin(u);
+	rs[0]=x*cos(omg)-y*ci*sin(omg);
+	rs[1]=x*sin(omg)+y*ci*cos(omg);
+	rs[2]=y*sin(o[1]);
+}
+/* geometric range and elevation of satellite at receiver ----------------------------------------- */
+double streamgen_t::satrange(int sat,gtime_t t,double *el) const{
+	double rs[3],e[3],azel[2],r;
+
+	satpos(sat,t,rs);
+	r=geodist(rs,rr,e);
+	t.timeadd(-r/CLIGHT); /* light time */
+	satpos(sat,t,rs);
+	r=geodist(rs,rr,e);
+	if (el) *el=satazel(pos,e,azel);
+	return r;
+}
+/* wave length of observation code (same as rtcm 3 encoder) --------------------------------------- */
+double streamgen_t::codewavelen(int sat,unsigned char code) const{
+	int freq=0;
+
+	code2obs(code,&freq);
+	if (satsys(sat,NULL)==SYS_CMP) {
+		if (freq==5) freq=2; /* B2 */
+		else if (freq==4) freq=3; /* B3 */
+	}
+	return satwavelen(sat,freq-1,&nav);
+}
+/* update broadcast ephemeris and ssr corrections at time ----------------------------------------- */
+void streamgen_t::updnav(int sat,gtime_t t){
+	const double *o=orb[sat-1];
+	gtime_t toe,tt;
+	double tow,dt,n,rs1[3],rs2[3];
+	int i,week,prn,sys=satsys(sat,&prn);
+	ssr_t *s=&ssr[sat-1];
+
+	tow=t.time2gpst(&week);
+
+	if (sys==SYS_GLO) {
+		geph_t *g=&nav.geph[prn-MINPRNGLO];
+		toe.gpst2time(week,floor(tow/TOEINT_GLO)*TOEINT_GLO);
+		if (g->sat!=sat||g->toe.time!=toe.time) {
+			g->sat=sat; g->frq=simfcn(prn-MINPRNGLO+1);
+			g->toe=g->tof=toe;
+			g->iode=(int)(fmod(toe.time+10800.0,86400.0)/900.0)&0x7F;
+			g->svh=g->sva=g->age=0;
+			satpos(sat,toe,g->pos);
+			tt=toe; satpos(sat,*tt.timeadd(-0.5),rs1);
+			tt=toe; satpos(sat,*tt.timeadd( 0.5),rs2);
+			for (i=0; i<3; i++) { g->vel[i]=rs2[i]-rs1[i]; g->acc[i]=0.0; }
+			g->taun=1E-5*(prn%10-5); g->gamn=g->dtaun=0.0;
+		}
+		s->iode=g->iode;
+	}
+	else {
+		eph_t *e=&nav.eph[sat-1];
+		toe.gpst2time(week,floor(tow/TOEINT_EPH)*TOEINT_EPH);
+		if (e->sat!=sat||e->toe.time!=toe.time) {
+			dt=toe.timediff(tref);
+			n=sqrt(MU_SIM/(o[0]*o[0]*o[0]));
+			e->sat=sat;
+			e->toe=e->toc=e->ttr=toe;
+			tt=toe;
+			if (sys==SYS_GAL) e->toes=tt.time2gst(&e->week);
+			else if (sys==SYS_CMP) e->toes=tt.gpst2bdt()->time2bdt(&e->week);
+			else e->toes=tt.time2gpst(&e->week);
+			e->A=o[0]; e->e=0.0; e->i0=o[1]; e->omg=0.0;
+			e->M0=fmod(o[3]+n*dt,2.0*PI);
+			e->OMG0=o[2]-OMGE*(dt-e->toes);
+			e->deln=e->OMGd=e->idot=0.0;
+			e->crc=e->crs=e->cuc=e->cus=e->cic=e->cis=0.0;
+			e->iode=e->iodc=(int)(toe.time/TOEINT_EPH)&0xFF;
+			e->sva=e->svh=e->flag=0; e->code=1; e->fit=4.0;
+			e->f0=1E-5*(prn%10-5); e->f1=e->f2=0.0;
+			for (i=0; i<4; i++) e->tgd[i]=0.0;
+		}
+		s->iode=e->iode;
+	}
+	/* ssr orbit/clock corrections */
+	tow=t.time2gpst(NULL);
+	s->t0[0]=s->t0[1]=t;
+	s->udi[0]=s->udi[1]=5.0;
+	s->iod[0]=s->iod[1]=1;
+	for (i=0; i<3; i++) {
+		s->deph [i]=0.1*sin(tow/600.0+sat+i);
+		s->ddeph[i]=1E-4*cos(tow/600.0+sat+i);
+	}
+	s->dclk[0]=0.2*sin(tow/300.0+sat); s->dclk[1]=s->dclk[2]=0.0;
+}
+/* simulate observation data of epoch ------------------------------------------------------------- */
+void streamgen_t::simobs(gtime_t t){
+	obsd_t *d;
+	gtime_t t1,t2;
+	double r,el,wl;
+	int i,j,k,sat;
+
+	time=t;
+	obs.n=0;
+	for (sat=1; sat<=MAXSAT; sat++) {
+		rng[sat-1]=0.0;
+		if (orb[sat-1][0]<=0.0) continue;
+		updnav(sat,t);
+		if ((r=satrange(sat,t,&el))<=0.0||el<ELMIN_SIM||obs.n>=MAXOBS) continue;
+
+		t1=t; t1.timeadd(-0.5);
+		t2=t; t2.timeadd( 0.5);
+		rng [sat-1]=r;
+		rate[sat-1]=satrange(sat,t2,NULL)-satrange(sat,t1,NULL);
+		elev[sat-1]=el;
+
+		k=sysindex(satsys(sat,NULL));
+		d=&obs.data[obs.n++];
+		d->sat=sat; d->time=t;
+		for (i=0; i<NFREQ+NEXOBS; i++) {
+			d->P[i]=d->L[i]=d->D[i]=0.0; d->SNR[i]=d->LLI[i]=d->code[i]=0;
+		}
+		for (j=0; j<NSIGSIM; j++) {
+			if (!(d->code[j]=simsys[k].code[j])||(wl=codewavelen(sat,d->code[j]))<=0.0) {
+				d->code[j]=0;
+				continue;
+			}
+			d->P[j]=rng[sat-1]+0.6*j;
+			d->L[j]=rng[sat-1]/wl+simamb(sat,j);
+			d->D[j]=(float)(-rate[sat-1]/wl);
+			d->SNR[j]=(unsigned char)((30.0+20.0*sin(el)-2.0*j)*4.0);
+		}
+	}
+}
+/* append rtcm 2 word with parity (6-of-8 bytes) ----------------------------------------------------
+* parity by D29*,D30* of previous word, data bits are complemented if D30*=1, bits are sent
+* from msb of word in bit 0 to 5 of each byte (bit 6 set)
+*-------------------------------------------------------------------------------------------------- */
+void streamgen_t::rtcm2word(unsigned int data,vector<unsigned char> &out){
+	const unsigned int hamming[]={
+		0xBB1F3480,0x5D8F9A40,0xAEC7CD00,0x5763E680,0x6BB1F340,0x8B7A89C0
+	};
+	unsigned int w=((word&3)<<30)|((data&0xFFFFFF)<<6),parity=0,u;
+	unsigned char b;
+	int i,j;
+
+	for (i=0; i<6; i++) {
+		parity<<=1;
+		for (u=(w&hamming[i])>>6; u; u>>=1) parity^=u&1;
+	}
+	w|=parity;
+	if (w&0x40000000) w^=0x3FFFFFC0;
+	word=w;
+
+	for (i=0; i<5; i++) {
+		for (j=0,b=0; j<6; j++) b|=((w>>(29-i*6-j))&1)<<j;
+		out.push_back(0x40|b);
+	}
+}
+/* append rtcm 2 message of data words ------------------------------------------------------------ */
+void streamgen_t::rtcm2msg(int type,const unsigned char *data,int nword,vector<unsigned char> &out){
+	double tow=time.time2gpst(NULL);
+	unsigned int zcnt=(unsigned int)floor(fmod(tow,3600.0)/0.6+1E-6);
+
+	/* D29*,D30* from last word of stream (streams share the generator) */
+	word=out.empty() ? 0 : (((out.back()>>4)&1)<<1)|((out.back()>>5)&1);
+	rtcm2word((RTCM2PREAMB<<16)|(type<<10),out); /* station id 0 */
+	rtcm2word((zcnt<<11)|(seqno<<8)|(nword<<3),out); /* health 0 */
+	seqno=(seqno+1)&7;
+	for (int i=0; i<nword; i++) {
+		rtcm2word((data[i*3]<<16)|(data[i*3+1]<<8)|data[i*3+2],out);
+	}
+}
+/* generate rtcm 2 message ---------------------------------------------------------------------------
+* type 3 (station), 18/19 (carrier-phase/pseudorange of freq, split by 15 satellites)
+* return : number of messages
+*-------------------------------------------------------------------------------------------------- */
+int streamgen_t::gen_rtcm2(int type,int freq,int sync,vector<unsigned char> &out){
+	const int maxsat=15; /* (31 words-1)/2 */
+	unsigned char buff[31*3];
+	double tow=time.time2gpst(NULL),L;
+	int i,j,n,nmsg=0,prn,sys,usec,index[MAXOBS];
+
+	if (type==3) {
+		bitwr_t bw(buff);
+		for (i=0; i<3; i++) bw.sets(32,(int)floor(sta.pos[i]/0.01+0.5));
+		bw.flush();
+		rtcm2msg(3,buff,4,out);
+		return 1;
+	}
+	usec=(int)floor((fmod(tow,3600.0)-floor(fmod(tow,3600.0)/0.6+1E-6)*0.6)*1E6+0.5);
+	if (usec<0) usec=0;
+
+	for (i=n=0; i<obs.n; i++) {
+		sys=satsys(obs.data[i].sat,NULL);
+		if ((sys==SYS_GPS||sys==SYS_GLO)&&obs.data[i].code[freq]) index[n++]=i;
+	}
+	if (n<=0) return 0;
+
+	for (i=0; i<n; i+=maxsat) {
+		bitwr_t bw(buff);
+		bw.setu(2,freq==0 ? 0 : 2);
+		bw.setu(2,0);
+		bw.setu(20,usec);
+		for (j=i; j<n&&j<i+maxsat; j++) {
+			const obsd_t *d=&obs.data[index[j]];
+			sys=satsys(d->sat,&prn);
+			if (sys==SYS_GLO) prn-=MINPRNGLO-1;
+			bw.setu(1,sync||j<n-1 ? 1 : 0);
+			bw.setu(1,d->code[freq]==CODE_L1P||d->code[freq]==CODE_L2P||
+				d->code[freq]==CODE_L2W ? 1 : 0);
+			bw.setu(1,sys==SYS_GLO ? 1 : 0);
+			bw.setu(5,prn==32 ? 0 : prn);
+			if (type==18) {
+				L=d->L[freq]-floor(d->L[freq]/4194304.0)*4194304.0; /* 2^22 cycles */
+				bw.setu(3,0); /* data quality */
+				bw.setu(5,loss[d->sat-1]);
+				bw.sets(32,(int)floor(-L*256.0+0.5));
+			}
+			else {
+				bw.setu(8,0); /* data quality, multipath error */
+				bw.setu(32,(unsigned int)floor(d->P[freq]/0.02+0.5));
+			}
+		}
+		bw.flush();
+		rtcm2msg(type,buff,1+(j-i)*2,out);
+		nmsg++;
+	}
+	return nmsg;
+}
+/* generate rtcm 3 message of epoch ------------------------------------------------------------------
+* ephemeris messages are generated for one satellite of system per epoch (round robin)
+* return : number of messages
+*-------------------------------------------------------------------------------------------------- */
+int streamgen_t::gen_rtcm3(int type,int iep,int sync,vector<unsigned char> &out){
+	int i,n=0,sys=0,sats[MAXSAT];
+
+	switch (type) {
+		case 1019: sys=SYS_GPS; break;
+		case 1020: sys=SYS_GLO; break;
+		case 1042: sys=SYS_CMP; break;
+		case 1045: case 1046: sys=SYS_GAL; break;
+	}
+	if (sys) {
+		for (i=0; i<MAXSAT; i++) if (orb[i][0]>0.0&&satsys(i+1,NULL)==sys) sats[n++]=i+1;
+		if (n<=0) return 0;
+		enc->ephsat=sats[iep%n];
+	}
+	enc->time=time;
+	if (enc->gen_rtcm3(type,sync)<=0) return 0;
+	out.insert(out.end(),enc->buff,enc->buff+enc->len);
+	return 1;
+}
+/* generate ubx rxm-rawx message (L1) ------------------------------------------------------------- */
+int streamgen_t::gen_ubx(vector<unsigned char> &out){
+	unsigned char buff[8+16+32*MAXOBS]={0},*p,cka=0,ckb=0;
+	double tow,wl,L,tl=time.timediff(ts)*1000.0;
+	int i,k,n=0,week,prn,sys,sat,fcn,len;
+
+	tow=time.time2gpst(&week);
+	for (i=0,p=buff+22; i<obs.n; i++) {
+		sat=obs.data[i].sat;
+		sys=satsys(sat,&prn);
+		k=sysindex(sys);
+		fcn=0;
+		if (sys==SYS_GLO) { prn-=MINPRNGLO-1; fcn=simfcn(prn); }
+		wl=CLIGHT/(sys==SYS_GLO ? FREQ1_GLO+DFRQ1_GLO*fcn : (sys==SYS_CMP ? FREQ1_CMP : FREQ1));
+		L=rng[sat-1]/wl+simamb(sat,0);
+		setR8(p   ,rng[sat-1]);
+		setR8(p+ 8,L);
+		setR4(p+16,(float)(-rate[sat-1]/wl));
+		p[20]=(unsigned char)simsys[k].ubxid;
+		p[21]=(unsigned char)prn;
+		p[22]=0; /* sigid */
+		p[23]=(unsigned char)(fcn+7);
+		setU2(p+24,(unsigned short)(tl<64500.0 ? tl : 64500.0)); /* lock time (ms) */
+		p[26]=(unsigned char)(30.0+20.0*sin(elev[sat-1]));
+		p[27]=p[28]=p[29]=2; /* std-dev of pr, cp, doppler */
+		p[30]=0x07; /* pr valid, cp valid, half cycle valid */
+		p+=32; n++;
+	}
+	len=16+32*n;
+	buff[0]=0xB5; buff[1]=0x62; buff[2]=0x02; buff[3]=0x15;
+	setU2(buff+4,(unsigned short)len);
+	setR8(buff+6,tow);
+	setU2(buff+14,(unsigned short)week);
+	buff[16]=18; /* leap seconds */
+	buff[17]=(unsigned char)n;
+	buff[18]=0x01; buff[19]=0x01; /* receiver status, version */
+
+	for (i=2; i<6+len; i++) { cka+=buff[i]; ckb+=cka; }
+	buff[6+len]=cka; buff[7+len]=ckb;
+	out.insert(out.end(),buff,buff+len+8);
+	return 1;
+}
+/* generate sbf measepoch block (type1: first signal, type2: other signals) ----------------------- */
+int streamgen_t::gen_sbf(vector<unsigned char> &out){
+	const int len1=20,len2=12;
+	vector<unsigned char> buff(20+obs.n*(len1+len2*(NSIGSIM-1))+4,0);
+	unsigned char *p,*q;
+	double tow,f,P,L,D1=0.0,tl=time.timediff(ts);
+	int i,j,k,m,week,prn,sys,sat,fcn,svid,nsig,len,off;
+
+	tow=time.time2gpst(&week);
+	for (i=0,p=&buff[20]; i<obs.n; i++) {
+		sat=obs.data[i].sat;
+		sys=satsys(sat,&prn);
+		k=sysindex(sys);
+		fcn=0;
+		switch (sys) {
+			case SYS_GLO: prn-=MINPRNGLO-1; fcn=simfcn(prn); svid=prn+37; break;
+			case SYS_GAL: svid=prn+70; break;
+			case SYS_CMP: svid=prn+140; break;
+			default:      svid=prn; break;
+		}
+		for (j=nsig=0,q=p+len1; j<NSIGSIM; j++) {
+			if (simsys[k].sbfsig[j]<0) continue;
+			f=sbffreq(simsys[k].sbfsig[j],fcn);
+			P=rng[sat-1]+0.6*j;
+			L=rng[sat-1]*f/CLIGHT+simamb(sat,j);
+			off=(int)floor((L-P*f/CLIGHT)*1000.0+0.5); /* carrier - code (mcycle) */
+			m=(int)floor((20.0+20.0*sin(elev[sat-1])-2.0*j)*4.0); /* cn0-10 dBHz */
+			if (j==0) {
+				D1=-rate[sat-1]*f/CLIGHT;
+				p[0]=(unsigned char)i; /* channel */
+				p[1]=(unsigned char)simsys[k].sbfsig[j];
+				p[2]=(unsigned char)svid;
+				p[3]=(unsigned char)(((long long)floor(P*1000.0+0.5)>>32)&0x0F);
+				setU4(p+4,(unsigned int)((long long)floor(P*1000.0+0.5)&0xFFFFFFFF));
+				setI4(p+8,(int)floor(D1*1E4+0.5));
+				setU2(p+12,(unsigned short)(off&0xFFFF));
+				p[14]=(unsigned char)(off>>16);
+				p[15]=(unsigned char)m;
+				setU2(p+16,(unsigned short)(tl<65534.0 ? tl : 65534.0));
+				p[18]=(unsigned char)((fcn+8)<<3);
+			}
+			else {
+				int co=(int)floor((P-rng[sat-1])*1000.0+0.5); /* code offset to type1 (mm) */
+				q[0]=(unsigned char)simsys[k].sbfsig[j];
+				q[1]=(unsigned char)(tl<254.0 ? tl : 254.0);
+				q[2]=(unsigned char)m;
+				q[3]=(unsigned char)((co>>16)&0x07); /* doppler offset msb 0 */
+				q[4]=(unsigned char)(off>>16);
+				q[5]=(unsigned char)((fcn+8)<<3);
+				setU2(q+6,(unsigned short)(co&0xFFFF));
+				setU2(q+8,(unsigned short)(off&0xFFFF));
+				setU2(q+10,0); /* doppler offset to scaled type1 doppler */
+				q+=len2; nsig++;
+			}
+		}
+		p[19]=(unsigned char)nsig;
+		p=q;
+	}
+	len=(int)(p-&buff[0]);
+	len=(len+3)/4*4; /* padding to multiple of 4 */
+	buff[0]='$'; buff[1]='@';
+	setU2(&buff[4],ID_MEASEPOCH);
+	setU2(&buff[6],(unsigned short)len);
+	setU4(&buff[8],(unsigned int)floor(tow*1000.0+0.5));
+	setU2(&buff[12],(unsigned short)week);
+	buff[14]=(unsigned char)obs.n;
+	buff[15]=len1; buff[16]=len2;
+	setU2(&buff[2],rtk_crc16(&buff[4],len-4));
+	out.insert(out.end(),buff.begin(),buff.begin()+len);
+	return 1;
+}
+/* append javad message with length and checksum -----------------------------------------------------
+* buff[5..] is payload of n bytes, header {id,hex length} and checksum are set, message is preceded
+* by cr/lf for sync of decoder
+*-------------------------------------------------------------------------------------------------- */
+void streamgen_t::javadmsg(const char *id,unsigned char *buff,int n,vector<unsigned char> &out){
+	unsigned char cs=0;
+	char hex[4];
+
+	sprintf(hex,"%03X",n+1);
+	buff[0]=id[0]; buff[1]=id[1];
+	buff[2]=hex[0]; buff[3]=hex[1]; buff[4]=hex[2];
+	for (int i=0; i<5+n; i++) cs=ROT_LEFT(cs)^buff[i];
+	buff[5+n]=ROT_LEFT(cs);
+	out.push_back('\r'); out.push_back('\n');
+	out.insert(out.end(),buff,buff+n+6);
+}
+/* generate javad messages of epoch (gps L1 C/A) -----------------------------------------------------
+* time base utc, receiver date [RD] only in first epoch, so time of day of [~~] is resolved by
+* decoder time
+* return : number of messages
+*-------------------------------------------------------------------------------------------------- */
+int streamgen_t::gen_javad(int iep,vector<unsigned char> &out){
+	unsigned char buff[6+8*MAXOBS];
+	gtime_t tu=time;
+	double ep[6];
+	int i,n,prn,nmsg=0,index[MAXOBS];
+
+	tu.gpst2utc();
+	tu.time2epoch(ep);
+	setU4(buff+5,(unsigned int)floor((ep[3]*3600.0+ep[4]*60.0+ep[5])*1000.0+0.5));
+	javadmsg("~~",buff,4,out); nmsg++;
+	if (iep==0) {
+		setU2(buff+5,(unsigned short)ep[0]);
+		buff[7]=(unsigned char)ep[1]; buff[8]=(unsigned char)ep[2];
+		buff[9]=1; /* utc(usno) */
+		javadmsg("RD",buff,5,out); nmsg++;
+	}
+	for (i=n=0; i<obs.n; i++) {
+		if (satsys(obs.data[i].sat,NULL)==SYS_GPS&&obs.data[i].P[0]!=0.0) index[n++]=i;
+	}
+	if (n<=0) return nmsg;
+
+	for (i=0; i<n; i++) {
+		satsys(obs.data[index[i]].sat,&prn);
+		buff[5+i]=(unsigned char)prn;
+	}
+	javadmsg("SI",buff,n,out);
+	for (i=0; i<n; i++) setR8(buff+5+i*8,obs.data[index[i]].P[0]/CLIGHT);
+	javadmsg("RC",buff,n*8,out);
+	return nmsg+2;
+}
+/* initialize constellation ----------------------------------------------------------------------- */
+void streamgen_t::init(gtime_t Ts,double Tint){
+	const double blh[3]={ 30.5*D2R,114.3*D2R,50.0 };
+	int i,k,sat,week,nper;
+
+	ts=time=Ts; tint=Tint;
+	ts.time2gpst(&week);
+	tref.gpst2time(week,0.0);
+
+	/* receiver and station */
+	for (i=0; i<3; i++) pos[i]=blh[i];
+	pos2ecef(pos,WGS84,rr);
+	for (i=0; i<3; i++) sta.pos[i]=rr[i];
+	sta.hgt=0.0; sta.itrf=0;
+
+	/* orbits of walker constellations */
+	nav.eph.assign(MAXSAT,eph_t()); nav.n=MAXSAT;
+	nav.geph.assign(NSATGLO,geph_t()); nav.ng=NSATGLO;
+	for (k=0; k<NSIMSYS; k++) {
+		nper=(simsys[k].nsat+simsys[k].nplane-1)/simsys[k].nplane;
+		for (i=0; i<simsys[k].nsat; i++) {
+			if (!(sat=satno(simsys[k].sys,simsys[k].prn0+i))) continue;
+			orb[sat-1][0]=simsys[k].a;
+			orb[sat-1][1]=simsys[k].inc*D2R;
+			orb[sat-1][2]=2.0*PI*(i%simsys[k].nplane)/simsys[k].nplane;
+			orb[sat-1][3]=2.0*PI*(i/simsys[k].nplane)/nper+PI*(i%simsys[k].nplane)/simsys[k].nsat;
+			updnav(sat,ts);
+		}
+	}
+	obs.data.assign(MAXOBS,obsd_t()); obs.n=0;
+
+	enc->staid=0;
+	enc->obs=&obs; enc->nav=&nav; enc->sta=&sta; enc->ssr=ssr;
+}
+/* generate streams of epochs --------------------------------------------------------------------- */
+long long streamgen_t::genstream(vector<benchstr_t> &str,int nepoch){
+	const int msm7[]={ 1077,1087,1097,1127 },ephs[]={ 1019,1020,1045,1042 };
+	const int ssrs[]={ 1060,1066,1243,1261 };
+	vector<unsigned char> *out;
+	gtime_t t;
+	long long nbyte=0;
+	int i,j,iep,n;
+
+	for (iep=0; iep<nepoch; iep++) {
+		t=ts; t.timeadd(iep*tint);
+		simobs(t);
+
+		for (i=0; i<(int)str.size(); i++) {
+			out=&str[i].data; n=0;
+
+			switch (str[i].format) {
+			case STRFMT_RTCM2:
+				if (str[i].type==3||(str[i].type==0&&iep%10==0)) n+=gen_rtcm2(3,0,1,*out);
+				if (str[i].type==18||str[i].type==0) {
+					n+=gen_rtcm2(18,0,1,*out);
+					n+=gen_rtcm2(18,1,str[i].type==0,*out);
+				}
+				if (str[i].type==19||str[i].type==0) {
+					n+=gen_rtcm2(19,0,1,*out);
+					n+=gen_rtcm2(19,1,0,*out);
+				}
+				break;
+			case STRFMT_RTCM3:
+				if (str[i].type) {
+					n+=gen_rtcm3(str[i].type,iep,0,*out);
+					break;
+				}
+				/* mixed: station, msm7, one ephemeris and ssr (5 s) */
+				if (iep%10==0) n+=gen_rtcm3(1006,iep,0,*out);
+				for (j=0; j<4; j++) n+=gen_rtcm3(msm7[j],iep,j<3,*out);
+				n+=gen_rtcm3(ephs[iep%4],iep/4,0,*out);
+				if (iep%5==0) for (j=0; j<4; j++) n+=gen_rtcm3(ssrs[j],iep,j<3,*out);
+				break;
+			case STRFMT_UBX:  n+=gen_ubx(*out); break;
+			case STRFMT_SEPT: n+=gen_sbf(*out); break;
+			case STRFMT_JAVAD: n+=gen_javad(iep,*out); break;
+			}
+			str[i].nmsg+=n;
+		}
+	}
+	for (i=0; i<(int)str.size(); i++) nbyte+=str[i].data.size();
+	return nbyte;
+}
+
+/* decoder throughput benchmark ----------------------------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+decbench_t::decbench_t(){
+}
+decbench_t::~decbench_t(){
+	str.clear();
+}
+/* new decoder of stream format ------------------------------------------------------------------- */
+static decode_data *newdecoder(int format){
+	decode_data *data;
+	switch (format){
+		case STRFMT_RTCM2: data=new rtcm_2; break;
+		case STRFMT_RTCM3: data=new rtcm_3; break;
+		case STRFMT_UBX:   data=new ublox;  break;
+		case STRFMT_SEPT:  data=new sbf;    break;
+		case STRFMT_JAVAD: data=new javad;  break;
+		default: return NULL;
+	}
+	data->format=format;
+	return data;
+}
+/* count decoded messages ------------------------------------------------------------------------- */
+static void countcb(decode_data *data,int ret,void *arg){
+	if (ret>0) (*(int *)arg)++;
+}
+/* epochs, observations and sum of observation time of log ---------------------------------------- */
+struct logcnt_t{
+	gtime_t t0;							/* reference time of sum */
+	int nepoch,nobs;					/* number of epochs and observations */
+	double tsum;						/* sum of observation time from t0 (s) */
+};
+static void epochcb(decode_data *data,int ret,void *arg){
+	logcnt_t *cnt=(logcnt_t *)arg;
+
+	if (ret!=1) return;
+	cnt->nepoch++; cnt->nobs+=data->obs.n;
+	for (int i=0; i<data->obs.n; i++) cnt->tsum+=data->obs.data[i].time.timediff(cnt->t0);
+}
+/* decode stream in passes until minimum time ----------------------------------------------------- */
+void decbench_t::decodestr(benchstr_t &s,double tmin){
+	decode_data *dec;
+	unsigned long long t0;
+	int ndec;
+
+	s.nrep=s.ndec=0; s.tdec=0.0;
+	if (s.data.empty()) return;
+
+	while (s.nrep<1||s.tdec<tmin) {
+		if (!(dec=newdecoder(s.format))) return;
+		dec->time=gen.ts;
+		if (s.format==STRFMT_RTCM3) { /* glonass frequency channels known from 1020 */
+			dec->nav->geph=gen.nav.geph; dec->nav->ng=gen.nav.ng;
+		}
+		ndec=0;
+		t0=tickget_ns();
+		dec->decode_buff(&s.data[0],(int)s.data.size(),countcb,&ndec);
+		s.tdec+=(tickget_ns()-t0)*1E-9;
+		delete dec;
+
+		s.ndec=ndec;
+		s.nrep++;
+	}
+}
+/* generate streams ------------------------------------------------------------------------------- */
+long long decbench_t::genstreams(gtime_t ts,double tint,int nepoch){
+	const int rtcm2[]={ 3,18,19,0 };
+	const int rtcm3[]={
+		1004,1012,1006,1074,1075,1076,1077,1084,1085,1086,1087,1094,1095,1096,1097,
+		1124,1125,1126,1127,1019,1020,1042,1045,1046,1057,1058,1060,1063,1064,1066,
+		1240,1241,1243,1258,1259,1261,0
+	};
+	vector<benchstr_t> jav;
+	benchstr_t s;
+	string buf;
+	long long nbyte;
+	int i;
+
+	str.clear();
+	s.nmsg=s.nrep=s.ndec=0; s.tdec=0.0;
+	s.format=STRFMT_RTCM2;
+	for (i=0; i<(int)(sizeof(rtcm2)/sizeof(int)); i++) {
+		s.type=rtcm2[i];
+		s.name="RTCM2 "+(rtcm2[i] ? to_string(rtcm2[i]) : string("mixed"));
+		str.push_back(s);
+	}
+	s.format=STRFMT_RTCM3;
+	for (i=0; i<(int)(sizeof(rtcm3)/sizeof(int)); i++) {
+		s.type=rtcm3[i];
+		s.name="RTCM3 "+(rtcm3[i] ? to_string(rtcm3[i]) : string("mixed"));
+		str.push_back(s);
+	}
+	s.format=STRFMT_UBX;  s.type=0x0215;       s.name="UBX RXM-RAWX";  str.push_back(s);
+	s.format=STRFMT_SEPT; s.type=ID_MEASEPOCH; s.name="SBF MeasEpoch"; str.push_back(s);
+
+	/* javad log at longer interval (day rollover of time of day) */
+	s.format=STRFMT_JAVAD; s.type=0; s.name="JAVAD 30s"; jav.push_back(s);
+	gen.init(ts,TINT_JAVAD);
+	nbyte=gen.genstream(jav,nepoch);
+
+	gen.init(ts,tint);
+	nbyte+=gen.genstream(str,nepoch);
+	str.push_back(jav[0]);
+	return nbyte;
+}
+/* decode all streams and measure throughput ------------------------------------------------------ */
+void decbench_t::run(double tmin){
+	for (int i=0; i<(int)str.size(); i++) decodestr(str[i],tmin);
+}
+/* output benchmark results ------------------------------------------------------------------------
+* per stream and per decoder (sum of single message type streams of format)
+*-------------------------------------------------------------------------------------------------- */
+void decbench_t::report(FILE *fp) const{
+	const int fmts[]={ STRFMT_RTCM2,STRFMT_RTCM3,STRFMT_UBX,STRFMT_SEPT };
+	const char *names[]={ "RTCM2","RTCM3","UBX","SBF" };
+	double t,tsum;
+	long long nbyte;
+	int i,j,nmsg;
+
+	fprintf(fp,"%-16s %11s %8s %8s %6s %9s %10s %9s\n","stream","bytes","msgs",
+		"decoded","passes","MB/s","kmsg/s","ns/msg");
+	for (i=0; i<(int)str.size(); i++) {
+		if (str[i].nrep<=0||str[i].nmsg<=0) continue;
+		t=str[i].tdec/str[i].nrep;
+		fprintf(fp,"%-16s %11d %8d %8d %6d %9.1f %10.1f %9.0f\n",str[i].name.c_str(),
+			(int)str[i].data.size(),str[i].nmsg,str[i].ndec,str[i].nrep,
+			str[i].data.size()/t*1E-6,str[i].nmsg/t*1E-3,t/str[i].nmsg*1E9);
+	}
+	fprintf(fp,"\n%-16s %11s %8s %9s %10s\n","decoder","bytes","msgs","MB/s","kmsg/s");
+	for (j=0; j<4; j++) {
+		nbyte=0; nmsg=0; tsum=0.0;
+		for (i=0; i<(int)str.size(); i++) {
+			if (str[i].format!=fmts[j]||str[i].nrep<=0) continue;
+			if (str[i].type==0) continue; /* mixed stream */
+			nbyte+=str[i].data.size(); nmsg+=str[i].nmsg;
+			tsum+=str[i].tdec/str[i].nrep;
+		}
+		if (tsum<=0.0) continue;
+		fprintf(fp,"%-16s %11lld %8d %9.1f %10.1f\n",names[j],nbyte,nmsg,nbyte/tsum*1E-6,
+			nmsg/tsum*1E-3);
+	}
+}
+/* serial and parallel decoding of receiver logs ---------------------------------------------------
+* receiver streams are written to a log file, decoded by one decoder in a pass and by rawlog_t
+* with worker threads, numbers of epochs and observations and sum of observation time (time of
+* day resolved on wrong day or time base) of both have to be equal
+*-------------------------------------------------------------------------------------------------- */
+int decbench_t::logcheck(FILE *fp,int nthread) const{
+	const char *file="decbench.log";
+	decode_data *dec;
+	rawlog_t *log;
+	logcnt_t cnt[2];
+	FILE *lp;
+	unsigned long long t0;
+	double t[2];
+	int i,j,ok,stat=1;
+
+	fprintf(fp,"%-16s %11s %8s %8s %9s %9s %8s %4s\n","log","bytes","epochs","obs",
+		"serial s","threads s","speedup","ok");
+	for (i=0; i<(int)str.size(); i++) {
+		if ((str[i].format!=STRFMT_UBX&&str[i].format!=STRFMT_SEPT&&
+			str[i].format!=STRFMT_JAVAD)||str[i].data.empty()) continue;
+
+		if (!(lp=fopen(file,"wb"))) return 0;
+		ok=fwrite(&str[i].data[0],1,str[i].data.size(),lp)==str[i].data.size();
+		fclose(lp);
+		if (!ok) { remove(file); return 0; }
+
+		for (j=0; j<2; j++) {
+			cnt[j].t0=gen.ts; cnt[j].nepoch=cnt[j].nobs=0; cnt[j].tsum=0.0;
+		}
+		/* one decoder */
+		if (!(dec=newdecoder(str[i].format))) { remove(file); return 0; }
+		dec->time=gen.ts;
+		t0=tickget_ns();
+		dec->decode_buff(&str[i].data[0],(int)str[i].data.size(),epochcb,&cnt[0]);
+		t[0]=(tickget_ns()-t0)*1E-9;
+		delete dec;
+
+		/* chunks by worker threads */
+		log=new rawlog_t;
+		t0=tickget_ns();
+		cnt[1].nepoch=log->decodelog(file,str[i].format,"",gen.ts,nthread);
+		t[1]=(tickget_ns()-t0)*1E-9;
+		cnt[1].nobs=log->obs.n;
+		for (j=0; j<log->obs.n; j++) cnt[1].tsum+=log->obs.data[j].time.timediff(gen.ts);
+
+		ok=cnt[1].nepoch==cnt[0].nepoch&&cnt[1].nobs==cnt[0].nobs&&
+			fabs(cnt[1].tsum-cnt[0].tsum)<=1E-3*(cnt[0].nobs+1);
+		if (!ok) stat=0;
+
+		fprintf(fp,"%-16s %11d %8d %8d %9.3f %9.3f %8.1f %4s\n",str[i].name.c_str(),
+			(int)str[i].data.size(),cnt[0].nepoch,cnt[0].nobs,t[0],t[1],
+			t[1]>0.0 ? t[0]/t[1] : 0.0,ok ? "yes" : "no");
+		if (!ok) {
+			fprintf(fp,"%-16s %11s %8d %8d %s (time sum diff %.3f s)\n","  threads","",
+				cnt[1].nepoch,cnt[1].nobs,log->errmsg.c_str(),cnt[1].tsum-cnt[0].tsum);
+		}
+		delete log;
+		remove(file);
+	}
+	return stat;
+}
@@ -0,0 +1,132 @@
+#ifndef DECBENCH_H
+#define DECBENCH_H
+#include "Decode/rtcm3e.h"
+
+/* Constant */
+#define NSIGSIM        3              /* number of simulated signals per satellite */
+
+/* synthetic byte stream and decoding result ------------------------------------------------------ */
+struct benchstr_t{
+	string name;						/* stream name (format and message type) */
+	int format;							/* stream format (STRFMT_???) */
+	int type;							/* message type (0:mixed messages of format) */
+	int nmsg;							/* number of generated messages */
+	vector<unsigned char> data;			/* stream data */
+	int nrep;							/* number of decoding passes */
+	int ndec;							/* decoded messages (ret>0) in one pass */
+	double tdec;						/* decoding time of all passes (s) */
+};
+
+/* synthetic constellation and stream generator ---------------------------------------------------
+* satellites on circular orbits (GPS/GLONASS/Galileo/BeiDou MEO) observed by a static receiver,
+* observations of each epoch are encoded to valid frames of the formats:
+*   STRFMT_RTCM2: type 3, 18, 19
+*   STRFMT_RTCM3: 1004, 1012, 1005/1006, msm 4-7, 1019, 1020, 1042, 1045/1046, ssr 1/2/4
+*   STRFMT_UBX  : RXM-RAWX
+*   STRFMT_SEPT : MeasEpoch
+*   STRFMT_JAVAD: [RD] (first epoch), [~~], [SI], [RC] (time base utc)
+* broadcast ephemerides (e=0, no perturbations) describe the same orbits as the simulation
+* ------------------------------------------------------------------------------------------------ */
+class streamgen_t{
+	/* Constructor */
+	public:
+		streamgen_t();
+		~streamgen_t();
+	/* Implementation functions */
+	protected:
+		/* satellite position of circular orbit (ecef) ---------------------------- */
+		void satpos(int sat,gtime_t t,double *rs) const;
+		/* geometric range and elevation of satellite at receiver ----------------- */
+		double satrange(int sat,gtime_t t,double *el) const;
+		/* wave length of observation code ---------------------------------------- */
+		double codewavelen(int sat,unsigned char code) const;
+		/* update broadcast ephemeris and ssr corrections at time ----------------- */
+		void updnav(int sat,gtime_t t);
+		/* simulate observation data of epoch ------------------------------------- */
+		void simobs(gtime_t t);
+		/* append rtcm 2 word with parity (6-of-8 bytes) -------------------------- */
+		void rtcm2word(unsigned int data,vector<unsigned char> &out);
+		/* append rtcm 2 message of data words ------------------------------------ */
+		void rtcm2msg(int type,const unsigned char *data,int nword,vector<unsigned char> &out);
+		/* generate rtcm 2 message ------------------------------------------------ */
+		int gen_rtcm2(int type,int freq,int sync,vector<unsigned char> &out);
+		/* generate rtcm 3 messages of epoch -------------------------------------- */
+		int gen_rtcm3(int type,int iep,int sync,vector<unsigned char> &out);
+		/* generate ubx rxm-rawx message ------------------------------------------ */
+		int gen_ubx(vector<unsigned char> &out);
+		/* generate sbf measepoch block ------------------------------------------- */
+		int gen_sbf(vector<unsigned char> &out);
+		/* append javad message with length and checksum -------------------------- */
+		void javadmsg(const char *id,unsigned char *buff,int n,vector<unsigned char> &out);
+		/* generate javad messages of epoch --------------------------------------- */
+		int gen_javad(int iep,vector<unsigned char> &out);
+	public:
+		/* initialize constellation -------------------------------------------------
+		* args   : gtime_t ts      I   start time (gpst)
+		*          double  tint    I   observation interval (s)
+		* return : none ---------------------------------------------------------- */
+		void init(gtime_t ts,double tint);
+		/* generate streams of epochs -----------------------------------------------
+		* args   : vector<benchstr_t> &str IO streams (name/format/type set by caller)
+		*          int    nepoch   I   number of epochs
+		* return : total bytes of generated streams ------------------------------ */
+		long long genstream(vector<benchstr_t> &str,int nepoch);
+	/* Components */
+	public:
+		gtime_t ts;						/* start time (gpst) */
+		gtime_t time;					/* time of current epoch (gpst) */
+		double tint;					/* observation interval (s) */
+		double rr[3],pos[3];			/* receiver position (ecef, geodetic) */
+		obs_t obs;						/* observation data of current epoch */
+		nav_t nav;						/* broadcast ephemerides of simulated orbits */
+		sta_t sta;						/* station parameters */
+		ssr_t *ssr;						/* ssr corrections (MAXSAT) */
+	protected:
+		rtcm3e_t *enc;					/* rtcm 3 encoder */
+		gtime_t tref;					/* reference time of orbit elements */
+		double orb[MAXSAT][4];			/* orbit elements {A,i,OMG,u} at tref (0:no satellite) */
+		double rng[MAXSAT],elev[MAXSAT];/* range and elevation of current epoch */
+		double rate[MAXSAT];			/* range rate of current epoch (m/s) */
+		unsigned char loss[MAXSAT];		/* loss of lock count (rtcm 2) */
+		unsigned int word;				/* last rtcm 2 word (D29*,D30*) */
+		int seqno;						/* rtcm 2 sequence number */
+};
+
+/* decoder throughput benchmark -------------------------------------------------------------------
+* streams are decoded by decode_buff() of a new decoder in repeated passes, throughput is
+* reported in MB/s and messages/s per stream (one message type or mixed messages of format).
+* receiver streams are also decoded as log files by rawlog_t and checked against one decoder,
+* the javad log is generated at 30 s interval to cover more than one day with default epochs
+* ------------------------------------------------------------------------------------------------ */
+class decbench_t{
+	/* Constructor */
+	public:
+		decbench_t();
+		~decbench_t();
+	/* Implementation functions */
+	protected:
+		/* decode stream in passes until minimum time ----------------------------- */
+		void decodestr(benchstr_t &s,double tmin);
+	public:
+		/* generate streams ---------------------------------------------------------
+		* args   : gtime_t ts      I   start time (gpst)
+		*          double  tint    I   observation interval (s)
+		*          int    nepoch   I   number of epochs
+		* return : total bytes of streams ---------------------------------------- */
+		long long genstreams(gtime_t ts,double tint,int nepoch);
+		/* decode all streams and measure throughput ------------------------------ */
+		void run(double tmin);
+		/* output benchmark results ----------------------------------------------- */
+		void report(FILE *fp) const;
+		/* serial and parallel decoding of receiver logs ----------------------------
+		* args   : FILE   *fp      I   output file pointer
+		*          int    nthread  I   number of threads of rawlog_t (0:number of cpus)
+		* return : 1:same epochs, observations and times, 0:different or error ---- */
+		int logcheck(FILE *fp,int nthread) const;
+	/* Components */
+	public:
+		streamgen_t gen;				/* stream generator */
+		vector<benchstr_t> str;			/* generated streams */
+};
+
+#endif
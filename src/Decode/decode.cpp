@@ -1,21 +1,60 @@
-#include "Decode/decode.h"
-
-/* decode data for kinds of formats ------------------------------------------------------------------
-------------------------------------------------------------------------------------------------------
---------------------------------------------------------------------------------------------------- */
-decode_data::decode_data(){
-	format=-1;
-	ephsat=0; dgps=NULL; Svr=NULL;
-	/* class */
-	obs.n=0; obs.data.assign(MAXOBS,obsd_t());
-	nav.n=MAXSAT; nav.ng=MAXPRNGLO;
-	nav.eph.assign(MAXSAT,eph_t()); nav.geph.assign(MAXPRNGLO,geph_t());
-
-	for (int i=0; i<MAXSAT; i++) ssr[i]=ssr_t();
-}
-decode_data::~decode_data(){
-	dgps=NULL; Svr=NULL;
-}
-int decode_data::decode(unsigned char data){
-	return 0;
+#include "Decode/decode.h"
+#include "BaseFunction/basefunction.h"
+
+/* navigation data store of decoders -----------------------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+navstore_t::navstore_t(){
+	const double lam_glo[NFREQ]={ CLIGHT/FREQ1_GLO,CLIGHT/FREQ2_GLO };
+
+	nav.n=MAXSAT; nav.ng=MAXPRNGLO;
+	nav.eph.assign(MAXSAT,eph_t()); nav.geph.assign(MAXPRNGLO,geph_t());
+	nav.seph.assign(NSATSBS*2,seph_t());
+	nav.alm.assign(MAXSAT,alm_t());
+	nav.na=MAXSAT; nav.ns=NSATSBS*2;
+	for (int i=0; i<MAXSAT; i++) for (int j=0; j<NFREQ; j++){
+		int sys;
+		if (!(sys=satsys(i+1,NULL))) continue;
+		nav.lam[i][j]=sys==SYS_GLO ? lam_glo[j] : WaveLengths[j];
+	}
+	for (int i=0; i<MAXSAT; i++) ssr[i]=ssr_t();
+}
+navstore_t::~navstore_t(){
+}
+
+/* decode data for kinds of formats ------------------------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+decode_data::decode_data(){
+	format=-1;
+	ephsat=0; dgps=NULL; Svr=NULL;
+	/* class */
+	obs.n=0; obs.data.assign(MAXOBS,obsd_t());
+	store=new navstore_t; ownstore=1;
+	nav=&store->nav; ssr=store->ssr;
+}
+decode_data::~decode_data(){
+	if (ownstore) delete store;
+	dgps=NULL; Svr=NULL;
+}
+/* attach shared navigation data store (NULL: own store) ------------------------------------------ */
+void decode_data::attachnav(navstore_t *Store){
+	if (Store==store) return;
+	if (ownstore) delete store;
+	if (Store) { store=Store; ownstore=0; }
+	else { store=new navstore_t; ownstore=1; }
+	nav=&store->nav; ssr=store->ssr;
+}
+int decode_data::decode(unsigned char data){
+	return 0;
+}
+int decode_data::decode_buff(const unsigned char *data,int n,decodecb_t cb,void *arg){
+	int i,ret,nmsg=0;
+
+	for (i=0; i<n; i++) {
+		if ((ret=decode(data[i]))<=0) continue;
+		if (cb) cb(this,ret,arg);
+		nmsg++;
+	}
+	return nmsg;
 }
\ No newline at end of file
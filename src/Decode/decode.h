@@ -1,34 +1,64 @@
-#ifndef DECODE_H
-#define DECODE_H
-
-#include "GNSS/DataClass/data.h"
-#include "BaseFunction/timesys.h"
-#include "GNSS/rtkpro.h"
-
-/* decode data for kinds of formats --------------------------------------------------------------- */
-class decode_data{
-	/* Consstructor */
-	public:
-		decode_data();
-		virtual ~decode_data();
-	/* Virtual Implementation functions */
-	public:
-		virtual int decode(unsigned char data);
-	/* Components */
-	public:
-		gtime_t time;					/* message time */
-		obs_t obs;						/* observation data */
-		nav_t nav;						/* satellite ephemerides */
-		sta_t sta;						/* station parameters */
-		lexmsg_t lexmsg;				/* LEX message */
-		sbsmsg_t sbsmsg;				/* SBAS message */
-		ssr_t ssr[MAXSAT];				/* output of ssr corrections */
-		string opt;						/* receiver dependent options */
-		int ephsat;						/* sat number of update ephemeris (0:no satellite) */
-		int format;						/* receiver stream format (only for raw_t) */
-		dgps_t *dgps;					/* output of dgps corrections (only for rtcm2) */
-		rtksvr_t  *Svr;					/* Pointer to RTK server structure
-									(when running in that environment otherwise NULL) */
-};
-
-#endif
+#ifndef DECODE_H
+#define DECODE_H
+
+#include "GNSS/DataClass/data.h"
+#include "BaseFunction/timesys.h"
+#include "GNSS/rtkpro.h"
+
+class decode_data;
+/* navigation data store of decoders --------------------------------------------------------------
+* ephemerides, ion/utc parameters and ssr corrections written by decoders.
+* a decoder owns its store unless a shared one is attached: the decoders of rtk server (run in
+* one thread) share one store, so an ephemeris repeated by another stream is seen as unchanged
+* ------------------------------------------------------------------------------------------------ */
+class navstore_t{
+	/* Constructor */
+	public:
+		navstore_t();
+		~navstore_t();
+	/* Components */
+	public:
+		nav_t nav;						/* satellite ephemerides */
+		ssr_t ssr[MAXSAT];				/* ssr corrections */
+};
+
+/* callback of decoded message (ret: message status >0 returned by decode()) ---------------------- */
+typedef void (*decodecb_t)(decode_data *dec,int ret,void *arg);
+
+/* decode data for kinds of formats --------------------------------------------------------------- */
+class decode_data{
+	/* Consstructor */
+	public:
+		decode_data();
+		virtual ~decode_data();
+	/* Virtual Implementation functions */
+	public:
+		/* input one byte of stream data ------------------------------------------ */
+		virtual int decode(unsigned char data);
+		/* input buffer of stream data, call cb for each decoded message ----------
+		* return number of decoded messages (default: decode() byte by byte) */
+		virtual int decode_buff(const unsigned char *data,int n,decodecb_t cb,void *arg);
+	public:
+		/* attach shared navigation data store (NULL: own store) ------------------ */
+		void attachnav(navstore_t *Store);
+	/* Components */
+	public:
+		gtime_t time;					/* message time */
+		obs_t obs;						/* observation data */
+		nav_t *nav;						/* satellite ephemerides (in store) */
+		sta_t sta;						/* station parameters */
+		lexmsg_t lexmsg;				/* LEX message */
+		sbsmsg_t sbsmsg;				/* SBAS message */
+		ssr_t *ssr;						/* output of ssr corrections (in store) */
+		string opt;						/* receiver dependent options */
+		int ephsat;						/* sat number of update ephemeris (0:no satellite) */
+		int format;						/* receiver stream format (only for raw_t) */
+		dgps_t *dgps;					/* output of dgps corrections (only for rtcm2) */
+		rtksvr_t  *Svr;					/* Pointer to RTK server structure
+									(when running in that environment otherwise NULL) */
+	protected:
+		navstore_t *store;				/* navigation data store */
+		int ownstore;					/* store is owned by decoder */
+};
+
+#endif
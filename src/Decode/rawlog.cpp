@@ -0,0 +1,449 @@
+/* Parallel decoder of raw receiver log file ------------------------------------------------------
+* the log is split at message boundaries found by the frame sync and checksum of the format:
+*   STRFMT_UBX  : B5 62 ... fletcher checksum
+*   STRFMT_OEM4 : AA 44 12 ... crc32
+*   STRFMT_SEPT : $@ ... crc16 (ccitt)
+*   STRFMT_JAVAD: ~~ (receiver time, start of epoch) ... rotated xor checksum
+* a split point needs two consecutive valid frames, so a sync pattern in payload is not taken.
+* each chunk is decoded by a new decoder after a lead-in of the previous chunk (lock time,
+* glonass frequency, ephemeris state), messages of the lead-in are not output.
+* javad logs have no week number and [~~] gives time of day only, so receiver time and time
+* base at the lead-in of each chunk are set by a serial scan of [~~]/[RD]/[::] frames.
+* ephemerides found in several chunks are merged to one record.
+--------------------------------------------------------------------------------------------------- */
+#include "Decode/rawlog.h"
+#include "BaseFunction/basefunction.h"
+#include "Decode/raw/javad.h"
+#include "Decode/raw/novatel.h"
+#include "Decode/raw/septentrio.h"
+#include "Decode/raw/ublox.h"
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
+/* constant --------------------------------------------------------------------------------------- */
+#define U2(p)       ((unsigned int)(p)[0]|((unsigned int)(p)[1]<<8))
+#define U4(p)       (U2(p)|(U2((p)+2)<<16))
+#define ROT_LEFT(val) ((unsigned char)(((val)<<2)|((val)>>6)))
+#define POLYCRC32   0xEDB88320u		/* crc32 polynomial */
+#define MAXFRMLEN   16384			/* max length of frame (bytes) */
+#define LOGBLOCK    (1024*1024)		/* size of decoded block (bytes) */
+
+/* new decoder of raw format ---------------------------------------------------------------------- */
+static decode_data *newraw(int format){
+	decode_data *data;
+	switch (format){
+		case STRFMT_OEM4:  data=new oem4;   break;
+		case STRFMT_UBX:   data=new ublox;  break;
+		case STRFMT_JAVAD: data=new javad;  break;
+		case STRFMT_SEPT:  data=new sbf;    break;
+		default: return NULL;
+	}
+	data->format=format;
+	return data;
+}
+/* crc32 of novatel oem4 -------------------------------------------------------------------------- */
+static unsigned int crc32(const unsigned char *buff,int len){
+	unsigned int crc=0;
+	for (int i=0; i<len; i++) {
+		crc^=buff[i];
+		for (int j=0; j<8; j++) crc=(crc&1) ? (crc>>1)^POLYCRC32 : crc>>1;
+	}
+	return crc;
+}
+/* decode hex length of javad message ------------------------------------------------------------- */
+static int javadlen(const unsigned char *p){
+	int len=0;
+	for (int i=0; i<3; i++) {
+		int c=p[i];
+		if      ('0'<=c&&c<='9') c-='0';
+		else if ('A'<=c&&c<='F') c-='A'-10;
+		else if ('a'<=c&&c<='f') c-='a'-10;
+		else return 0;
+		len=len*16+c;
+	}
+	return len;
+}
+/* number of processors --------------------------------------------------------------------------- */
+static int ncpu(){
+#ifdef WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long n=sysconf(_SC_NPROCESSORS_ONLN);
+	return n<1 ? 1 : (int)n;
+#endif
+}
+/* compare ephemerides (sat, toe, iode) ----------------------------------------------------------- */
+static bool cmpeph(const eph_t &a,const eph_t &b){
+	if (a.sat!=b.sat) return a.sat<b.sat;
+	if (a.toe.time!=b.toe.time) return a.toe.time<b.toe.time;
+	return a.iode<b.iode;
+}
+static bool cmpgeph(const geph_t &a,const geph_t &b){
+	if (a.sat!=b.sat) return a.sat<b.sat;
+	return a.toe.time<b.toe.time;
+}
+/* output of chunk decoder (called for each decoded message) -------------------------------------- */
+static void chunkcb(decode_data *dec,int ret,void *arg){
+	logchunk_t *chunk=(logchunk_t *)arg;
+	int prn;
+
+	if (ret==1) { /* observation epoch */
+		for (int i=0; i<dec->obs.n; i++) chunk->obs.push_back(dec->obs.data[i]);
+	}
+	else if (ret==2&&dec->ephsat>0) { /* ephemeris */
+		if (satsys(dec->ephsat,&prn)==SYS_GLO) {
+			for (size_t i=0; i<dec->nav->geph.size(); i++) {
+				if (dec->nav->geph[i].sat!=dec->ephsat) continue;
+				chunk->geph.push_back(dec->nav->geph[i]);
+				break;
+			}
+		}
+		else if (dec->ephsat<=(int)dec->nav->eph.size()) {
+			chunk->eph.push_back(dec->nav->eph[dec->ephsat-1]);
+		}
+	}
+	else if (ret==9) { /* ion/utc parameters */
+		for (int i=0; i<8; i++) chunk->ion_gps[i]=dec->nav->ion_gps[i];
+		for (int i=0; i<8; i++) chunk->ion_cmp[i]=dec->nav->ion_cmp[i];
+		for (int i=0; i<4; i++) chunk->ion_gal[i]=dec->nav->ion_gal[i];
+		for (int i=0; i<4; i++) chunk->utc_gps[i]=dec->nav->utc_gps[i];
+		for (int i=0; i<4; i++) chunk->utc_gal[i]=dec->nav->utc_gal[i];
+		for (int i=0; i<4; i++) chunk->utc_cmp[i]=dec->nav->utc_cmp[i];
+		chunk->leaps=dec->nav->leaps;
+		chunk->ionutc=1;
+	}
+}
+/* decode thread ---------------------------------------------------------------------------------- */
+#ifdef WIN32
+static DWORD WINAPI logworker(void *arg)
+#else
+static void * logworker(void *arg)
+#endif
+{
+	rawlog_t *log=(rawlog_t *) arg;
+
+	while (log->decodejob()) ;
+#ifdef WIN32
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+/* parallel decoder of raw receiver log file -----------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+/* Constructor -------------------------------------------------------------------------------------- */
+rawlog_t::rawlog_t(){
+	nepoch=format=next=0;
+	buff=NULL; size=0;
+#ifdef WIN32
+	hfile=hmap=NULL;
+#else
+	fd=-1;
+#endif
+	initlock(&lock);
+}
+rawlog_t::~rawlog_t(){
+	closelog();
+}
+/* Implementation functions ------------------------------------------------------------------------- */
+/* memory map log file ---------------------------------------------------------------------------- */
+int rawlog_t::openlog(const char *file){
+#ifdef WIN32
+	LARGE_INTEGER fsize;
+
+	if ((hfile=CreateFileA(file,GENERIC_READ,FILE_SHARE_READ,NULL,OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL,NULL))==INVALID_HANDLE_VALUE) {
+		hfile=NULL;
+		return 0;
+	}
+	if (!GetFileSizeEx(hfile,&fsize)||fsize.QuadPart<=0) return 0;
+	size=(size_t)fsize.QuadPart;
+	if (!(hmap=CreateFileMapping(hfile,NULL,PAGE_READONLY,0,0,NULL))) return 0;
+	if (!(buff=(const unsigned char *)MapViewOfFile(hmap,FILE_MAP_READ,0,0,0))) return 0;
+#else
+	struct stat st;
+	void *p;
+
+	if ((fd=open(file,O_RDONLY))<0) return 0;
+	if (fstat(fd,&st)<0||st.st_size<=0) return 0;
+	size=(size_t)st.st_size;
+	if ((p=mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0))==MAP_FAILED) return 0;
+	madvise(p,size,MADV_SEQUENTIAL);
+	buff=(const unsigned char *)p;
+#endif
+	return 1;
+}
+/* unmap log file --------------------------------------------------------------------------------- */
+void rawlog_t::closelog(){
+#ifdef WIN32
+	if (buff) UnmapViewOfFile(buff);
+	if (hmap) CloseHandle(hmap);
+	if (hfile) CloseHandle(hfile);
+	hfile=hmap=NULL;
+#else
+	if (buff) munmap((void *)buff,size);
+	if (fd>=0) close(fd);
+	fd=-1;
+#endif
+	buff=NULL; size=0;
+}
+/* test valid frame at position, return length of frame (0:invalid) ------------------------------- */
+int rawlog_t::testframe(size_t p) const{
+	const unsigned char *q=buff+p;
+	size_t n=size-p;
+	int len;
+
+	switch (format) {
+		case STRFMT_UBX: { /* B5 62 class id len(2) payload ck_a ck_b */
+			unsigned char cka=0,ckb=0;
+			if (n<8||q[0]!=0xB5||q[1]!=0x62) return 0;
+			if ((len=U2(q+4)+8)>MAXFRMLEN||(size_t)len>n) return 0;
+			for (int i=2; i<len-2; i++) { cka+=q[i]; ckb+=cka; }
+			return cka==q[len-2]&&ckb==q[len-1] ? len : 0;
+		}
+		case STRFMT_OEM4: /* AA 44 12 hlen ... msglen(2) ... crc32 */
+			if (n<28||q[0]!=0xAA||q[1]!=0x44||q[2]!=0x12) return 0;
+			if ((len=U2(q+8)+28+4)>MAXFRMLEN||(size_t)len>n) return 0;
+			return crc32(q,len-4)==U4(q+len-4) ? len : 0;
+		case STRFMT_SEPT: /* $@ crc(2) id(2) len(2) ... */
+			if (n<8||q[0]!='$'||q[1]!='@') return 0;
+			if ((len=U2(q+6))<8||(len&3)||len>MAXFRMLEN||(size_t)len>n) return 0;
+			return rtk_crc16(q+4,len-4)==U2(q+2) ? len : 0;
+		case STRFMT_JAVAD: { /* id(2) len(3,hex) payload cs */
+			unsigned char cs=0;
+			if (n<6||q[0]<'0'||'~'<q[0]||q[1]<'0'||'~'<q[1]) return 0;
+			if ((len=javadlen(q+2)+5)<=5||len>MAXFRMLEN||(size_t)len>n) return 0;
+			for (int i=0; i<len-1; i++) cs=ROT_LEFT(cs)^q[i];
+			return ROT_LEFT(cs)==q[len-1] ? len : 0;
+		}
+	}
+	return 0;
+}
+/* search split point at or after position (pe: no split point found) ----------------------------- */
+size_t rawlog_t::splitpoint(size_t p,size_t pe) const{
+	int len,len2;
+
+	for (; p<pe; p++) {
+		/* javad epoch starts with receiver time message ~~ */
+		if (format==STRFMT_JAVAD&&(buff[p]!='~'||p+1>=size||buff[p+1]!='~')) continue;
+		if (!(len=testframe(p))) continue;
+
+		/* next frame (or javad message after cr/lf) */
+		if (p+len>=size) return p;
+		len2=testframe(p+len);
+		if (!len2&&format==STRFMT_JAVAD) {
+			size_t q=p+len;
+			while (q<size&&q<p+len+2&&(buff[q]=='\r'||buff[q]=='\n')) q++;
+			if (q>=size||testframe(q)) return p;
+		}
+		if (len2) return p;
+	}
+	return pe;
+}
+/* receiver time of javad chunks by serial scan of time frames ---------------------------------------
+* [~~] receiver time, [RD] receiver date and [::] epoch time are input to one decoder in log
+* order, its time and time base at lead-in of each chunk are set to the chunk
+*-------------------------------------------------------------------------------------------------- */
+void rawlog_t::seedtime(){
+	javad *dec=new javad;
+	size_t p=0;
+	int len=1;
+
+	dec->time=time;
+	dec->opt=opt;
+	for (size_t i=0; i<chunk.size(); i++) {
+		for (; p<chunk[i].pl; p+=len>0 ? len : 1) {
+			if (!(len=testframe(p))) continue;
+			if ((buff[p]!='~'||buff[p+1]!='~')&&(buff[p]!='R'||buff[p+1]!='D')&&
+				(buff[p]!=':'||buff[p+1]!=':')) continue;
+			if (p>0) dec->decode_buff(buff+p-1,1,NULL,NULL); /* sync by preceding cr/lf */
+			dec->decode_buff(buff+p,len,NULL,NULL);
+		}
+		chunk[i].time=dec->time;
+		chunk[i].tbase=dec->tbase;
+	}
+	delete dec;
+}
+/* decode one chunk with new decoder -------------------------------------------------------------- */
+int rawlog_t::decodechunk(logchunk_t *chunk){
+	decode_data *dec;
+
+	if (!(dec=newraw(format))) return -1;
+	dec->time=time;
+	dec->opt=opt;
+	if (format==STRFMT_JAVAD) { /* receiver time at lead-in, sync by preceding byte */
+		dec->time=chunk->time;
+		((raw_t *)dec)->tbase=chunk->tbase;
+		if (chunk->pl>0) dec->decode_buff(buff+chunk->pl-1,1,NULL,NULL);
+	}
+
+	/* lead-in of previous chunk to set decoder state (no output) */
+	if (chunk->pl<chunk->ps) {
+		dec->decode_buff(buff+chunk->pl,(int)(chunk->ps-chunk->pl),NULL,NULL);
+	}
+	/* reserve observation buffer by data rate of first small block */
+	size_t p=chunk->ps,n=chunk->pe-chunk->ps<LOGBLOCK/16 ? chunk->pe-chunk->ps : LOGBLOCK/16;
+	dec->decode_buff(buff+p,(int)n,chunkcb,chunk);
+	chunk->obs.reserve(chunk->obs.size()*(chunk->pe-chunk->ps)/n*11/10+MAXOBS);
+	for (p+=n; p<chunk->pe; p+=n) {
+		n=chunk->pe-p<LOGBLOCK ? chunk->pe-p : LOGBLOCK;
+		dec->decode_buff(buff+p,(int)n,chunkcb,chunk);
+	}
+
+	delete dec;
+	return 1;
+}
+/* merge decoded chunks to obs/nav ---------------------------------------------------------------- */
+void rawlog_t::mergechunk(){
+	size_t nobs=0,neph=0,ngeph=0;
+	int sorted=1;
+
+	for (size_t i=0; i<chunk.size(); i++) {
+		nobs+=chunk[i].obs.size(); neph+=chunk[i].eph.size(); ngeph+=chunk[i].geph.size();
+	}
+	/* observation data (chunks are in time order unless receiver time jumped back) */
+	obs.data.clear(); obs.data.reserve(nobs);
+	for (size_t i=0; i<chunk.size(); i++) {
+		if (!chunk[i].obs.empty()&&!obs.data.empty()&&
+			chunk[i].obs.front().time.timediff(obs.data.back().time)<0.0) sorted=0;
+		obs.data.insert(obs.data.end(),chunk[i].obs.begin(),chunk[i].obs.end());
+		vector<obsd_t>().swap(chunk[i].obs);
+	}
+	obs.n=(int)obs.data.size();
+	nepoch=sorted ? 0 : sortobs(obs);
+	for (int i=0,j; sorted&&i<obs.n; i=j,nepoch++) {
+		for (j=i+1; j<obs.n; j++) {
+			if (obs.data[j].time.timediff(obs.data[i].time)>DTTOL) break;
+		}
+	}
+	/* ephemerides (same ephemeris in several chunks to one) */
+	nav.eph.clear(); nav.eph.reserve(neph);
+	nav.geph.clear(); nav.geph.reserve(ngeph);
+	for (size_t i=0; i<chunk.size(); i++) {
+		nav.eph.insert(nav.eph.end(),chunk[i].eph.begin(),chunk[i].eph.end());
+		nav.geph.insert(nav.geph.end(),chunk[i].geph.begin(),chunk[i].geph.end());
+	}
+	stable_sort(nav.eph.begin(),nav.eph.end(),cmpeph);
+	stable_sort(nav.geph.begin(),nav.geph.end(),cmpgeph);
+	size_t n=0;
+	for (size_t i=0; i<nav.eph.size(); i++) {
+		if (n>0&&nav.eph[n-1].sat==nav.eph[i].sat&&nav.eph[n-1].iode==nav.eph[i].iode&&
+			nav.eph[n-1].toe.time==nav.eph[i].toe.time) continue;
+		nav.eph[n++]=nav.eph[i];
+	}
+	nav.eph.resize(n); nav.n=nav.nmax=(int)n;
+	n=0;
+	for (size_t i=0; i<nav.geph.size(); i++) {
+		if (n>0&&nav.geph[n-1].sat==nav.geph[i].sat&&
+			fabs(nav.geph[i].toe.timediff(nav.geph[n-1].toe))<1.0) continue;
+		nav.geph[n++]=nav.geph[i];
+	}
+	nav.geph.resize(n); nav.ng=nav.ngmax=(int)n;
+	nav.indexnav();
+
+	/* ion/utc parameters of last chunk with them */
+	for (int i=(int)chunk.size()-1; i>=0; i--) {
+		if (!chunk[i].ionutc) continue;
+		for (int j=0; j<8; j++) nav.ion_gps[j]=chunk[i].ion_gps[j];
+		for (int j=0; j<8; j++) nav.ion_cmp[j]=chunk[i].ion_cmp[j];
+		for (int j=0; j<4; j++) nav.ion_gal[j]=chunk[i].ion_gal[j];
+		for (int j=0; j<4; j++) nav.utc_gps[j]=chunk[i].utc_gps[j];
+		for (int j=0; j<4; j++) nav.utc_gal[j]=chunk[i].utc_gal[j];
+		for (int j=0; j<4; j++) nav.utc_cmp[j]=chunk[i].utc_cmp[j];
+		nav.leaps=chunk[i].leaps;
+		break;
+	}
+}
+/* decode log of next chunk (for worker thread), return 0 if no chunk left ------------------------ */
+int rawlog_t::decodejob(){
+	int i;
+
+	tolock(&lock);
+	i=next<(int)chunk.size() ? next++ : -1;
+	tounlock(&lock);
+
+	if (i<0) return 0;
+	chunk[i].stat=decodechunk(&chunk[i]);
+	return 1;
+}
+/* decode raw log file ---------------------------------------------------------------------------- */
+int rawlog_t::decodelog(const char *file,int format,const char *rcvopt,gtime_t ts,
+	int nthread){
+	vector<thread_t> thread;
+	size_t csize,p,q;
+	int nchunk;
+
+	this->format=format;
+	opt=rcvopt ? rcvopt : "";
+	time=ts;
+	nepoch=0;
+	chunk.clear();
+
+	if (format!=STRFMT_UBX&&format!=STRFMT_OEM4&&format!=STRFMT_SEPT&&format!=STRFMT_JAVAD) {
+		errmsg="unsupported log format";
+		return -1;
+	}
+	if (!openlog(file)) {
+		closelog();
+		errmsg="log file open error: "+string(file);
+		return -1;
+	}
+	if (nthread<=0) nthread=ncpu();
+
+	/* split log into chunks at frame boundaries */
+	nchunk=nthread*4;
+	csize=(size+nchunk-1)/nchunk;
+	if (csize>MAXLOGCHUNK) csize=MAXLOGCHUNK;
+	if (csize<LOGLEADIN) csize=LOGLEADIN;
+	for (p=0; p<size; p=q) {
+		logchunk_t c;
+		c.ps=p;
+		c.pe=q=p+csize>=size ? size : splitpoint(p+csize,size);
+		c.pl=p;
+		c.stat=c.ionutc=c.leaps=c.tbase=0;
+		c.time=ts;
+		if (!chunk.empty()) {
+			size_t pl=p-chunk.back().ps>LOGLEADIN ? p-LOGLEADIN : chunk.back().ps;
+			c.pl=splitpoint(pl,p);
+		}
+		chunk.push_back(c);
+	}
+	if (format==STRFMT_JAVAD) seedtime();
+
+	/* decode chunks by worker threads (caller thread is one of them) */
+	next=0;
+	for (int i=0; i<nthread-1&&i<(int)chunk.size()-1; i++) {
+		thread_t th;
+		#ifdef WIN32
+		if (!(th=CreateThread(NULL,0,logworker,this,0,NULL))) break;
+		#else
+		if (pthread_create(&th,NULL,logworker,this)) break;
+		#endif
+		thread.push_back(th);
+	}
+	while (decodejob()) ;
+	for (size_t i=0; i<thread.size(); i++) {
+#ifdef WIN32
+		WaitForSingleObject(thread[i],INFINITE);
+		CloseHandle(thread[i]);
+#else
+		pthread_join(thread[i],NULL);
+#endif
+	}
+	closelog();
+
+	for (size_t i=0; i<chunk.size(); i++) {
+		if (chunk[i].stat>=0) continue;
+		errmsg="log decode error";
+		chunk.clear();
+		return -1;
+	}
+	mergechunk();
+	chunk.clear();
+	return nepoch;
+}
@@ -0,0 +1,84 @@
+#ifndef RAWLOG_H
+#define RAWLOG_H
+#include "Decode/raw.h"
+
+/* Constant */
+#define MAXLOGCHUNK    (64*1024*1024) /* max size of log chunk (bytes) */
+#define LOGLEADIN      (256*1024)     /* size of lead-in to prime decoder state (bytes) */
+
+/* decoded chunk of raw log ----------------------------------------------------------------------- */
+struct logchunk_t{
+	size_t ps,pe;						/* start/end position in log (bytes) */
+	size_t pl;							/* start position of lead-in (bytes) */
+	int stat;							/* status (0:not decoded,1:decoded,-1:error) */
+	int ionutc;							/* ion/utc parameters flag */
+	vector<obsd_t> obs;					/* observation data */
+	vector<eph_t> eph;					/* GPS/QZS/GAL/BDS ephemerides */
+	vector<geph_t> geph;				/* GLONASS ephemerides */
+	double ion_gps[8],utc_gps[4];		/* GPS ion/utc parameters */
+	double ion_gal[4],utc_gal[4];		/* Galileo ion/utc parameters */
+	double ion_cmp[8],utc_cmp[4];		/* BeiDou ion/utc parameters */
+	int leaps;							/* leap seconds (s) */
+	gtime_t time;						/* receiver time at lead-in (javad) */
+	int tbase;							/* time base at lead-in (javad) */
+};
+
+/* parallel decoder of raw receiver log file ------------------------------------------------------
+* the log file is memory mapped and split into chunks at message boundaries of the format,
+* chunks are decoded by worker threads with independent decoders and merged in time order
+* (supported format: STRFMT_UBX, STRFMT_OEM4, STRFMT_SEPT, STRFMT_JAVAD)
+* ------------------------------------------------------------------------------------------------ */
+class rawlog_t{
+	/* Constructor */
+	public:
+		rawlog_t();
+		~rawlog_t();
+	/* Implementation functions */
+	protected:
+		/* memory map/unmap log file ---------------------------------------------- */
+		int openlog(const char *file);
+		void closelog();
+		/* test valid frame at position, return length of frame (0:invalid) ------ */
+		int testframe(size_t p) const;
+		/* search split point at or after position -------------------------------- */
+		size_t splitpoint(size_t p,size_t pe) const;
+		/* receiver time of javad chunks by serial scan of time frames ------------ */
+		void seedtime();
+		/* decode one chunk with new decoder -------------------------------------- */
+		int decodechunk(logchunk_t *chunk);
+		/* merge decoded chunks to obs/nav ---------------------------------------- */
+		void mergechunk();
+	public:
+		/* decode log of next chunk (for worker thread) --------------------------- */
+		int decodejob();
+		/* decode raw log file -----------------------------------------------------
+		* args   : char   *file    I   raw log file path
+		*          int    format   I   stream format (STRFMT_???)
+		*          char   *rcvopt  I   receiver dependent options
+		*          gtime_t ts      I   approximate start time of log (for week number)
+		*          int    nthread  I   number of worker threads (0:number of cpus)
+		* return : number of observation epochs (-1:error) ---------------------- */
+		int decodelog(const char *file,int format,const char *rcvopt,gtime_t ts,int nthread);
+	/* Components */
+	public:
+		obs_t obs;						/* merged observation data (sorted by time) */
+		nav_t nav;						/* merged navigation data */
+		int nepoch;						/* number of observation epochs */
+		string errmsg;					/* error message */
+	protected:
+		int format;						/* stream format (STRFMT_???) */
+		string opt;						/* receiver dependent options */
+		gtime_t time;					/* approximate start time of log */
+		const unsigned char *buff;		/* mapped log data */
+		size_t size;					/* size of log data (bytes) */
+#ifdef WIN32
+		HANDLE hfile,hmap;				/* file and mapping handle */
+#else
+		int fd;							/* file descriptor */
+#endif
+		vector<logchunk_t> chunk;		/* chunks of log */
+		int next;						/* next chunk to decode */
+		lock_t lock;					/* lock flag */
+};
+
+#endif
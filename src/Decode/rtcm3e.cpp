@@ -0,0 +1,872 @@
+#include "Decode/rtcm3e.h"
+#include "BaseFunction/basefunction.h"
+
+/* encode rtcm 3 class -------------------------------------------------------------------------------
+* references :
+*     [1] RTCM Standard 10403.2, Differential GNSS (Global Navigation Satellite
+*         Systems) Services - version 3, with amendment 1/2, november 7, 2013
+*     [2] RTCM Paper 059-2011-SC104-635 (draft Galileo and QZSS ssr messages)
+*
+* notes  : field layouts and scale factors are same as decoder of rtcm_3 (rtcm.cpp),
+*          lock time and phase-range offset of each signal are kept in rtcm3e_t
+* ------------------------------------------------------------------------------------------------ */
+
+/* Constant */
+#define RTCM3PREAMB 0xD3        /* rtcm ver.3 frame preamble */
+#define PRUNIT_GPS  299792.458  /* rtcm ver.3 unit of gps pseudorange (m) */
+#define PRUNIT_GLO  599584.916  /* rtcm ver.3 unit of glonass pseudorange (m) */
+#define RANGE_MS    (CLIGHT*0.001)      /* range in 1 ms */
+
+#define P2_10       0.0009765625          /* 2^-10 */
+#define P2_34       5.820766091346740E-11 /* 2^-34 */
+#define P2_46       1.421085471520200E-14 /* 2^-46 */
+#define P2_59       1.734723475976810E-18 /* 2^-59 */
+#define P2_66       1.355252715606880E-20 /* 2^-66 */
+
+#define ROUND(x)    ((int)(long long)floor((x)+0.5))
+#define ROUND_U(x)  ((unsigned int)(long long)floor((x)+0.5))
+
+/* msm signal id table (rtcm.cpp) --------------------------------------------*/
+extern const char *msm_sig_gps[32];
+extern const char *msm_sig_glo[32];
+extern const char *msm_sig_gal[32];
+extern const char *msm_sig_qzs[32];
+extern const char *msm_sig_sbs[32];
+extern const char *msm_sig_cmp[32];
+
+/* ssr update intervals ------------------------------------------------------*/
+static const double ssrudint[16]={
+	1,2,5,10,15,30,60,120,240,300,600,900,1800,3600,7200,10800
+};
+
+/* carrier-phase - pseudorange in cycle (-750 to 750 cycle) ------------------------------------- */
+static double cp_pr(double cp,double pr_cyc){
+	double x=fmod(cp-pr_cyc+750.0,1500.0);
+	if (x<0.0) x+=1500.0;
+	return x-750.0;
+}
+/* lock time indicator of type 1001-1012 (ref [1] table 3.4-2) ----------------------------------- */
+static int to_lock(int lock){
+	if (lock<0  ) return 0;
+	if (lock<24 ) return lock;
+	if (lock<72 ) return (lock+24  )/2;
+	if (lock<168) return (lock+120 )/4;
+	if (lock<360) return (lock+408 )/8;
+	if (lock<744) return (lock+1176)/16;
+	if (lock<937) return (lock+3096)/32;
+	return 127;
+}
+/* lock time indicator of msm 4 (ref [1] table 3.5-74) ------------------------------------------- */
+static int to_msm_lock(double lock){
+	int i;
+	if (lock<0.032) return 0;
+	for (i=1; i<15&&lock>=0.032*(1<<i); i++) ;
+	return i;
+}
+/* lock time indicator with extended range and resolution of msm 7 (ref [1] table 3.5-76) -------- */
+static int to_msm_lock_ex(double lock){
+	int i,lock_ms=(int)(lock*1000.0);
+	if (lock<0.0) return 0;
+	if (lock_ms<64) return lock_ms;
+	for (i=1; i<=20; i++) { /* 64*2^(i-1) <= lock_ms < 64*2^i */
+		if (lock_ms<(64<<i)) return 32*i+(lock_ms>>i);
+	}
+	return 704;
+}
+/* satellite system to msm table index ------------------------------------------------------------ */
+static int sys2msm(int sys){
+	switch (sys) {
+	case SYS_GPS: return 0;
+	case SYS_GLO: return 1;
+	case SYS_GAL: return 2;
+	case SYS_QZS: return 3;
+	case SYS_SBS: return 4;
+	case SYS_CMP: return 5;
+	}
+	return -1;
+}
+
+/* RTCM 3 encoder type -------------------------------------------------------------------------------
+------------------------------------------------------------------------------------------------------
+--------------------------------------------------------------------------------------------------- */
+/* Constructor ------------------------------------------------------------------------------------ */
+rtcm3e_t::rtcm3e_t(){
+	const char **sigs[6]={ msm_sig_gps,msm_sig_glo,msm_sig_gal,msm_sig_qzs,msm_sig_sbs,msm_sig_cmp };
+	unsigned char code;
+	int i,j,freq;
+
+	staid=seqno=ephsat=len=0;
+	time.time=0; time.sec=0.0;
+	obs=NULL; nav=NULL; sta=NULL; ssr=NULL;
+
+	for (i=0; i<MAXSAT; i++) for (j=0; j<NFREQ+NEXOBS; j++) {
+		cp[i][j]=0.0; lltime[i][j].time=0; lltime[i][j].sec=0.0;
+	}
+	/* obs code to msm signal id and frequency (strings only used here) */
+	for (i=0; i<6; i++) {
+		for (j=0; j<=MAXCODE; j++) msmsig[i][j]=0;
+		for (j=0; j<32; j++) {
+			if (!*sigs[i][j]||(code=obs2code(sigs[i][j],NULL))==CODE_NONE) continue;
+			if (!msmsig[i][code]) msmsig[i][code]=(unsigned char)(j+1);
+		}
+	}
+	for (j=0; j<=MAXCODE; j++) {
+		code2obs((unsigned char)j,&freq);
+		codefrq[j]=(unsigned char)freq;
+	}
+}
+rtcm3e_t::~rtcm3e_t(){
+	obs=NULL; nav=NULL; sta=NULL; ssr=NULL;
+}
+/* Implementation functions ----------------------------------------------------------------------- */
+/* glonass frequency channel number (-7..6, -8: unknown) of slot number --------------------------- */
+int rtcm3e_t::glofcn(int prn) const{
+	if (!nav||prn<1||prn>NSATGLO) return -8;
+	if ((int)nav->geph.size()>=prn&&nav->geph[prn-1].sat==satno(SYS_GLO,prn+MINPRNGLO-1)) {
+		return nav->geph[prn-1].frq;
+	}
+	if (nav->glo_fcn[prn-1]) return nav->glo_fcn[prn-1]-8;
+	return -8;
+}
+/* lock time (s) of signal ------------------------------------------------------------------------ */
+double rtcm3e_t::locktime(const obsd_t *data,int freq){
+	gtime_t *t=&lltime[data->sat-1][freq];
+
+	if (!t->time||(data->LLI[freq]&1)) *t=data->time;
+	return data->time.timediff(*t);
+}
+/* encode type 1001-1004 message header ----------------------------------------------------------- */
+void rtcm3e_t::encode_head1001(bitwr_t &bw,int type,int nsat,int sync){
+	double tow=time.time2gpst(NULL);
+
+	bw.setu(12,type);
+	bw.setu(12,staid);
+	bw.setu(30,ROUND_U(tow*1000.0));
+	bw.setu( 1,sync);
+	bw.setu( 5,nsat);
+	bw.setu( 1,0); /* smoothing indicator */
+	bw.setu( 3,0); /* smoothing interval */
+}
+/* encode type 1009-1012 message header ----------------------------------------------------------- */
+void rtcm3e_t::encode_head1009(bitwr_t &bw,int type,int nsat,int sync){
+	gtime_t t=time;
+	double tod;
+
+	t.gpst2utc()->timeadd(10800.0); /* gpst -> glonass time */
+	tod=fmod(t.time2gpst(NULL),86400.0);
+
+	bw.setu(12,type);
+	bw.setu(12,staid);
+	bw.setu(27,ROUND_U(tod*1000.0));
+	bw.setu( 1,sync);
+	bw.setu( 5,nsat);
+	bw.setu( 1,0); /* smoothing indicator */
+	bw.setu( 3,0); /* smoothing interval */
+}
+/* encode type 1004: extended L1&L2 gps rtk observables ------------------------------------------- */
+int rtcm3e_t::encode_type1004(int sync){
+	const obsd_t *data;
+	const double lam1=CLIGHT/FREQ1,lam2=CLIGHT/FREQ2;
+	double pr1c;
+	int i,j,n=0,prn,sys,index[MAXOBS],code1,code2,pr1,pr21,ppr1,ppr2,amb;
+	bitwr_t bw(buff,24);
+
+	for (i=0; i<obs->n&&n<31; i++) {
+		sys=satsys(obs->data[i].sat,&prn);
+		if (sys==SYS_GPS||(sys==SYS_SBS&&prn>=120)) index[n++]=i;
+	}
+	encode_head1001(bw,1004,n,sync);
+
+	for (j=0; j<n; j++) {
+		data=&obs->data[index[j]];
+		sys=satsys(data->sat,&prn);
+		if (sys==SYS_SBS) prn-=80;
+
+		pr1=amb=0; pr1c=0.0;
+		ppr1=ppr2=-524288; pr21=-8192; /* invalid values */
+
+		if (data->P[0]!=0.0) {
+			amb=(int)floor(data->P[0]/PRUNIT_GPS);
+			pr1=ROUND((data->P[0]-amb*PRUNIT_GPS)/0.02);
+			pr1c=pr1*0.02+amb*PRUNIT_GPS;
+
+			if (data->L[0]!=0.0) {
+				ppr1=ROUND(cp_pr(data->L[0],pr1c/lam1)*lam1/0.0005);
+			}
+			if (data->P[1]!=0.0&&fabs(data->P[1]-pr1c)<=163.82) {
+				pr21=ROUND((data->P[1]-pr1c)/0.02);
+			}
+			if (data->L[1]!=0.0) {
+				ppr2=ROUND(cp_pr(data->L[1],pr1c/lam2)*lam2/0.0005);
+			}
+		}
+		code1=data->code[0]==CODE_L1P||data->code[0]==CODE_L1W||data->code[0]==CODE_L1Y;
+		switch (data->code[1]) {
+		case CODE_L2P: code2=1; break;
+		case CODE_L2D: code2=2; break;
+		case CODE_L2W: case CODE_L2Y: code2=3; break;
+		default: code2=0; break;
+		}
+		bw.setu( 6,prn);
+		bw.setu( 1,code1);
+		bw.setu(24,pr1);
+		bw.sets(20,ppr1);
+		bw.setu( 7,to_lock((int)locktime(data,0)));
+		bw.setu( 8,amb);
+		bw.setu( 8,data->SNR[0]);
+		bw.setu( 2,code2);
+		bw.sets(14,pr21);
+		bw.sets(20,ppr2);
+		bw.setu( 7,to_lock((int)locktime(data,1)));
+		bw.setu( 8,data->SNR[1]);
+	}
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1012: extended L1&L2 glonass rtk observables --------------------------------------- */
+int rtcm3e_t::encode_type1012(int sync){
+	const obsd_t *data;
+	double lam1,lam2,pr1c;
+	int i,j,n=0,prn,fcn,index[MAXOBS],pr1,pr21,ppr1,ppr2,amb;
+	bitwr_t bw(buff,24);
+
+	for (i=0; i<obs->n&&n<31; i++) {
+		if (satsys(obs->data[i].sat,&prn)!=SYS_GLO||glofcn(prn-MINPRNGLO+1)<-7) continue;
+		index[n++]=i;
+	}
+	encode_head1009(bw,1012,n,sync);
+
+	for (j=0; j<n; j++) {
+		data=&obs->data[index[j]];
+		satsys(data->sat,&prn); prn-=MINPRNGLO-1;
+		fcn=glofcn(prn);
+		lam1=CLIGHT/(FREQ1_GLO+DFRQ1_GLO*fcn);
+		lam2=CLIGHT/(FREQ2_GLO+DFRQ2_GLO*fcn);
+
+		pr1=amb=0; pr1c=0.0;
+		ppr1=ppr2=-524288; pr21=-8192; /* invalid values */
+
+		if (data->P[0]!=0.0) {
+			amb=(int)floor(data->P[0]/PRUNIT_GLO);
+			pr1=ROUND((data->P[0]-amb*PRUNIT_GLO)/0.02);
+			pr1c=pr1*0.02+amb*PRUNIT_GLO;
+
+			if (data->L[0]!=0.0) {
+				ppr1=ROUND(cp_pr(data->L[0],pr1c/lam1)*lam1/0.0005);
+			}
+			if (data->P[1]!=0.0&&fabs(data->P[1]-pr1c)<=163.82) {
+				pr21=ROUND((data->P[1]-pr1c)/0.02);
+			}
+			if (data->L[1]!=0.0) {
+				ppr2=ROUND(cp_pr(data->L[1],pr1c/lam2)*lam2/0.0005);
+			}
+		}
+		bw.setu( 6,prn);
+		bw.setu( 1,data->code[0]==CODE_L1P);
+		bw.setu( 5,fcn+7);
+		bw.setu(25,pr1);
+		bw.sets(20,ppr1);
+		bw.setu( 7,to_lock((int)locktime(data,0)));
+		bw.setu( 7,amb);
+		bw.setu( 8,data->SNR[0]);
+		bw.setu( 2,data->code[1]==CODE_L2P);
+		bw.sets(14,pr21);
+		bw.sets(20,ppr2);
+		bw.setu( 7,to_lock((int)locktime(data,1)));
+		bw.setu( 8,data->SNR[1]);
+	}
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1005/1006: stationary rtk reference station arp (height) --------------------------- */
+int rtcm3e_t::encode_type1005(int type){
+	bitwr_t bw(buff,24);
+
+	bw.setu(12,type);
+	bw.setu(12,staid);
+	bw.setu( 6,sta->itrf);
+	bw.setu( 4,7); /* gps/glonass/galileo indicator, reference station indicator */
+	bw.sets38(floor(sta->pos[0]/0.0001+0.5));
+	bw.setu( 2,0); /* oscillator indicator, reserved */
+	bw.sets38(floor(sta->pos[1]/0.0001+0.5));
+	bw.setu( 2,0); /* quarter cycle indicator */
+	bw.sets38(floor(sta->pos[2]/0.0001+0.5));
+	if (type==1006) {
+		bw.setu(16,ROUND_U(sta->hgt/0.0001));
+	}
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1019: gps ephemerides -------------------------------------------------------------- */
+int rtcm3e_t::encode_type1019(){
+	const eph_t *eph;
+	int prn,sys=satsys(ephsat,&prn);
+	bitwr_t bw(buff,24);
+
+	if (sys!=SYS_GPS&&!(sys==SYS_SBS&&prn>=120)) return 0;
+	if (sys==SYS_SBS) prn-=80;
+	if ((int)nav->eph.size()<ephsat) return 0;
+	eph=&nav->eph[ephsat-1];
+	if (eph->sat!=ephsat) return 0;
+
+	bw.setu(12,1019);
+	bw.setu( 6,prn);
+	bw.setu(10,eph->week%1024);
+	bw.setu( 4,eph->sva);
+	bw.setu( 2,eph->code);
+	bw.sets(14,ROUND(eph->idot/P2_43/SC2RAD));
+	bw.setu( 8,eph->iode);
+	bw.setu(16,ROUND_U(eph->toc.time2gpst(NULL)/16.0));
+	bw.sets( 8,ROUND(eph->f2/P2_55));
+	bw.sets(16,ROUND(eph->f1/P2_43));
+	bw.sets(22,ROUND(eph->f0/P2_31));
+	bw.setu(10,eph->iodc);
+	bw.sets(16,ROUND(eph->crs/P2_5));
+	bw.sets(16,ROUND(eph->deln/P2_43/SC2RAD));
+	bw.sets(32,ROUND(eph->M0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->cuc/P2_29));
+	bw.setu(32,ROUND_U(eph->e/P2_33));
+	bw.sets(16,ROUND(eph->cus/P2_29));
+	bw.setu(32,ROUND_U(sqrt(eph->A)/P2_19));
+	bw.setu(16,ROUND_U(eph->toes/16.0));
+	bw.sets(16,ROUND(eph->cic/P2_29));
+	bw.sets(32,ROUND(eph->OMG0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->cis/P2_29));
+	bw.sets(32,ROUND(eph->i0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->crc/P2_5));
+	bw.sets(32,ROUND(eph->omg/P2_31/SC2RAD));
+	bw.sets(24,ROUND(eph->OMGd/P2_43/SC2RAD));
+	bw.sets( 8,ROUND(eph->tgd[0]/P2_31));
+	bw.setu( 6,eph->svh);
+	bw.setu( 1,eph->flag);
+	bw.setu( 1,eph->fit==4.0 ? 0 : 1); /* 0:4hr,1:>4hr */
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1020: glonass ephemerides ---------------------------------------------------------- */
+int rtcm3e_t::encode_type1020(){
+	const geph_t *geph;
+	gtime_t t;
+	int j,prn,tk,tb;
+	bitwr_t bw(buff,24);
+
+	if (satsys(ephsat,&prn)!=SYS_GLO) return 0;
+	prn-=MINPRNGLO-1; /* slot number */
+	if ((int)nav->geph.size()<prn) return 0;
+	geph=&nav->geph[prn-1];
+	if (geph->sat!=ephsat) return 0;
+
+	/* frame time and epoch in glonass time of day */
+	t=geph->tof; t.gpst2utc()->timeadd(10800.0);
+	tk=ROUND(fmod(t.time2gpst(NULL),86400.0)/30.0);
+	t=geph->toe; t.gpst2utc()->timeadd(10800.0);
+	tb=ROUND(fmod(t.time2gpst(NULL),86400.0)/900.0);
+
+	bw.setu(12,1020);
+	bw.setu( 6,prn);
+	bw.setu( 5,geph->frq+7);
+	bw.setu( 4,0); /* almanac health, P1 */
+	bw.setu( 5,tk/120);
+	bw.setu( 6,(tk%120)/2);
+	bw.setu( 1,tk%2);
+	bw.setu( 1,geph->svh&1);
+	bw.setu( 1,0); /* P2 */
+	bw.setu( 7,tb&0x7F);
+	for (j=0; j<3; j++) {
+		bw.setg(24,geph->vel[j]/P2_20/1E3);
+		bw.setg(27,geph->pos[j]/P2_11/1E3);
+		bw.setg( 5,geph->acc[j]/P2_30/1E3);
+	}
+	bw.setu( 1,0); /* P3 */
+	bw.setg(11,geph->gamn/P2_40);
+	bw.setu( 3,0); /* P, ln */
+	bw.setg(22,geph->taun/P2_30);
+	bw.setg( 5,geph->dtaun/P2_30);
+	bw.setu( 5,geph->age);
+	bw.setu( 1,0); /* P4 */
+	bw.setu( 4,geph->sva);
+	bw.skip(11+2+1+11+32+5+22+1+7); /* NT,M,additional data,NA,tauc,N4,tauGPS,ln,reserved */
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1042: beidou ephemerides ----------------------------------------------------------- */
+int rtcm3e_t::encode_type1042(){
+	const eph_t *eph;
+	gtime_t toe,toc;
+	double toes,tocs;
+	int prn,week;
+	bitwr_t bw(buff,24);
+
+	if (satsys(ephsat,&prn)!=SYS_CMP) return 0;
+	if ((int)nav->eph.size()<ephsat) return 0;
+	eph=&nav->eph[ephsat-1];
+	if (eph->sat!=ephsat) return 0;
+
+	toe=eph->toe; toes=toe.gpst2bdt()->time2bdt(&week); /* gpst -> bdt */
+	toc=eph->toc; tocs=toc.gpst2bdt()->time2bdt(NULL);
+
+	bw.setu(12,1042);
+	bw.setu( 6,prn);
+	bw.setu(13,week%8192);
+	bw.setu( 4,eph->sva);
+	bw.sets(14,ROUND(eph->idot/P2_43/SC2RAD));
+	bw.setu( 5,eph->iode);
+	bw.setu(17,ROUND_U(tocs/8.0));
+	bw.sets(11,ROUND(eph->f2/P2_66));
+	bw.sets(22,ROUND(eph->f1/P2_50));
+	bw.sets(24,ROUND(eph->f0/P2_33));
+	bw.setu( 5,eph->iodc);
+	bw.sets(18,ROUND(eph->crs/P2_6));
+	bw.sets(16,ROUND(eph->deln/P2_43/SC2RAD));
+	bw.sets(32,ROUND(eph->M0/P2_31/SC2RAD));
+	bw.sets(18,ROUND(eph->cuc/P2_31));
+	bw.setu(32,ROUND_U(eph->e/P2_33));
+	bw.sets(18,ROUND(eph->cus/P2_31));
+	bw.setu(32,ROUND_U(sqrt(eph->A)/P2_19));
+	bw.setu(17,ROUND_U(toes/8.0));
+	bw.sets(18,ROUND(eph->cic/P2_31));
+	bw.sets(32,ROUND(eph->OMG0/P2_31/SC2RAD));
+	bw.sets(18,ROUND(eph->cis/P2_31));
+	bw.sets(32,ROUND(eph->i0/P2_31/SC2RAD));
+	bw.sets(18,ROUND(eph->crc/P2_6));
+	bw.sets(32,ROUND(eph->omg/P2_31/SC2RAD));
+	bw.sets(24,ROUND(eph->OMGd/P2_43/SC2RAD));
+	bw.sets(10,ROUND(eph->tgd[0]/1E-10));
+	bw.sets(10,ROUND(eph->tgd[1]/1E-10));
+	bw.setu( 1,eph->svh&1);
+	bw.flush();
+	return bw.tell();
+}
+/* encode type 1045/1046: galileo f/nav, i/nav ephemerides ---------------------------------------- */
+int rtcm3e_t::encode_type1045(int type){
+	const eph_t *eph;
+	gtime_t toe,toc;
+	double toes,tocs;
+	int prn,week;
+	bitwr_t bw(buff,24);
+
+	if (satsys(ephsat,&prn)!=SYS_GAL) return 0;
+	if ((int)nav->eph.size()<ephsat) return 0;
+	eph=&nav->eph[ephsat-1];
+	if (eph->sat!=ephsat) return 0;
+
+	toe=eph->toe; toes=toe.time2gst(&week);
+	toc=eph->toc; tocs=toc.time2gst(NULL);
+
+	bw.setu(12,type);
+	bw.setu( 6,prn);
+	bw.setu(12,week%4096);
+	bw.setu(10,eph->iode);
+	bw.setu( 8,eph->sva);
+	bw.sets(14,ROUND(eph->idot/P2_43/SC2RAD));
+	bw.setu(14,ROUND_U(tocs/60.0));
+	bw.sets( 6,ROUND(eph->f2/P2_59));
+	bw.sets(21,ROUND(eph->f1/P2_46));
+	bw.sets(31,ROUND(eph->f0/P2_34));
+	bw.sets(16,ROUND(eph->crs/P2_5));
+	bw.sets(16,ROUND(eph->deln/P2_43/SC2RAD));
+	bw.sets(32,ROUND(eph->M0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->cuc/P2_29));
+	bw.setu(32,ROUND_U(eph->e/P2_33));
+	bw.sets(16,ROUND(eph->cus/P2_29));
+	bw.setu(32,ROUND_U(sqrt(eph->A)/P2_19));
+	bw.setu(14,ROUND_U(toes/60.0));
+	bw.sets(16,ROUND(eph->cic/P2_29));
+	bw.sets(32,ROUND(eph->OMG0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->cis/P2_29));
+	bw.sets(32,ROUND(eph->i0/P2_31/SC2RAD));
+	bw.sets(16,ROUND(eph->crc/P2_5));
+	bw.sets(32,ROUND(eph->omg/P2_31/SC2RAD));
+	bw.sets(24,ROUND(eph->OMGd/P2_43/SC2RAD));
+	bw.sets(10,ROUND(eph->tgd[0]/P2_32)); /* E5a/E1 */
+	if (type==1045) {
+		bw.setu( 2,(eph->svh>>4)&3); /* E5a OSHS */
+		bw.setu( 1,(eph->svh>>3)&1); /* E5a OSDVS */
+		bw.setu( 7,0);               /* reserved */
+	}
+	else {
+		bw.sets(10,ROUND(eph->tgd[1]/P2_32)); /* E5b/E1 */
+		bw.setu( 2,(eph->svh>>7)&3); /* E5b OSHS */
+		bw.setu( 1,(eph->svh>>6)&1); /* E5b OSDVS */
+		bw.setu( 2,(eph->svh>>1)&3); /* E1 OSHS */
+		bw.setu( 1,eph->svh&1);      /* E1 OSDVS */
+		bw.setu( 2,0);               /* reserved */
+	}
+	bw.flush();
+	return bw.tell();
+}
+/* encode ssr 1,2,4: orbit, clock, combined corrections ----------------------------------------------
+* subtype 1: orbit, 2: clock, 4: orbit and clock
+* ------------------------------------------------------------------------------------------------- */
+int rtcm3e_t::encode_ssr(int type,int sys,int subtype,int sync){
+	const ssr_t *s=NULL;
+	gtime_t t;
+	double tow;
+	int i,j,n=0,nmax,prn,udi,np,ni,nj,offp,ns=6,nbit,index[MAXSAT];
+	bitwr_t bw(buff,24);
+
+	switch (sys) {
+	case SYS_GPS: np=6; ni= 8; nj= 0; offp=  0; break;
+	case SYS_GLO: np=5; ni= 8; nj= 0; offp=MINPRNGLO-1; break;
+	case SYS_GAL: np=6; ni=10; nj= 0; offp=  0; break;
+	case SYS_QZS: np=4; ni= 8; nj= 0; offp=192; break;
+	case SYS_CMP: np=6; ni=10; nj=24; offp=  1; break;
+	case SYS_SBS: np=6; ni= 9; nj=24; offp=120; break;
+	default: return 0;
+	}
+#ifndef SSR_QZSS_DRAFT_V05
+	ns=sys==SYS_QZS ? 4 : 6;
+#endif
+	/* satellites in a message (limited by number of satellite field and frame length) */
+	nbit=subtype==1 ? 121+np+ni+nj : (subtype==2 ? 70+np : 191+np+ni+nj);
+	nmax=(1023*8-(sys==SYS_GLO ? 65 : 68))/nbit;
+	if (nmax>(1<<ns)-1) nmax=(1<<ns)-1;
+
+	for (i=0; i<MAXSAT&&n<nmax; i++) {
+		if (satsys(i+1,&prn)!=sys) continue;
+		if ((subtype&1)&&!ssr[i].t0[0].time) continue;
+		if ((subtype&2)&&!ssr[i].t0[1].time) continue;
+		if ((subtype&4)&&(!ssr[i].t0[0].time||!ssr[i].t0[1].time)) continue;
+		index[n++]=i;
+	}
+	if (n<=0) return 0;
+	s=&ssr[index[0]];
+	j=subtype==2 ? 1 : 0;
+	for (udi=0; udi<15&&ssrudint[udi]<s->udi[j]; udi++) ;
+
+	bw.setu(12,type);
+	if (sys==SYS_GLO) {
+		t=s->t0[j]; t.gpst2utc()->timeadd(10800.0);
+		bw.setu(17,ROUND_U(fmod(t.time2gpst(NULL),86400.0)));
+	}
+	else {
+		tow=s->t0[j].time2gpst(NULL);
+		bw.setu(20,ROUND_U(tow));
+	}
+	bw.setu( 4,udi);
+	bw.setu( 1,sync);
+	if (subtype!=2) bw.setu(1,s->refd);
+	bw.setu( 4,s->iod[j]);
+	bw.setu(16,0); /* provider id */
+	bw.setu( 4,0); /* solution id */
+	bw.setu(ns,n);
+
+	for (i=0; i<n; i++) {
+		s=&ssr[index[i]];
+		satsys(index[i]+1,&prn);
+		bw.setu(np,prn-offp);
+		if (subtype!=2) {
+			bw.setu(ni,s->iode);
+			bw.setu(nj,s->iodcrc);
+			bw.sets(22,ROUND(s->deph[0]/1E-4));
+			bw.sets(20,ROUND(s->deph[1]/4E-4));
+			bw.sets(20,ROUND(s->deph[2]/4E-4));
+			bw.sets(21,ROUND(s->ddeph[0]/1E-6));
+			bw.sets(19,ROUND(s->ddeph[1]/4E-6));
+			bw.sets(19,ROUND(s->ddeph[2]/4E-6));
+		}
+		if (subtype!=1) {
+			bw.sets(22,ROUND(s->dclk[0]/1E-4));
+			bw.sets(21,ROUND(s->dclk[1]/1E-6));
+			bw.sets(27,ROUND(s->dclk[2]/2E-8));
+		}
+	}
+	bw.flush();
+	return bw.tell();
+}
+/* encode msm message header ---------------------------------------------------------------------- */
+void rtcm3e_t::encode_msm_head(bitwr_t &bw,int type,int sys,int sync,const msm_h_t *h){
+	gtime_t t=time;
+	double tow;
+	int i,j,dow;
+
+	bw.setu(12,type);
+	bw.setu(12,staid);
+
+	if (sys==SYS_GLO) {
+		t.gpst2utc()->timeadd(10800.0); /* gpst -> glonass time */
+		tow=t.time2gpst(NULL);
+		dow=(int)(tow/86400.0);
+		bw.setu( 3,dow);
+		bw.setu(27,ROUND_U((tow-dow*86400.0)*1000.0));
+	}
+	else if (sys==SYS_CMP) {
+		tow=t.time2gpst(NULL)-14.0; /* gpst -> bdt */
+		if (tow<0.0) tow+=604800.0;
+		bw.setu(30,ROUND_U(tow*1000.0));
+	}
+	else {
+		tow=t.time2gpst(NULL);
+		bw.setu(30,ROUND_U(tow*1000.0));
+	}
+	bw.setu( 1,sync);
+	bw.setu( 3,seqno);
+	bw.setu( 7,h->time_s);
+	bw.setu( 2,h->clk_str);
+	bw.setu( 2,h->clk_ext);
+	bw.setu( 1,h->smooth);
+	bw.setu( 3,h->tint_s);
+	for (i=j=0; i<64; i++) { /* satellite mask */
+		bw.setu(1,j<h->nsat&&(int)h->sats[j]==i+1);
+		if (j<h->nsat&&(int)h->sats[j]==i+1) j++;
+	}
+	for (i=j=0; i<32; i++) { /* signal mask */
+		bw.setu(1,j<h->nsig&&h->sigs[j]==i+1);
+		if (j<h->nsig&&h->sigs[j]==i+1) j++;
+	}
+	for (i=0; i<h->nsat*h->nsig; i++) { /* cell mask */
+		bw.setu(1,h->cellmask[i]);
+	}
+}
+/* encode msm 4-7: full pseudorange and phaserange plus cnr ------------------------------------------
+* msm 4/5: 15 bit pseudorange, 22 bit phaserange, 4 bit lock time, 6 bit cnr
+* msm 6/7: 20 bit pseudorange, 24 bit phaserange, 10 bit lock time, 10 bit cnr
+* msm 5/7: extended satellite info and phaserangerate
+* ------------------------------------------------------------------------------------------------- */
+int rtcm3e_t::encode_msm(int type,int sys,int msm,int sync){
+	msm_h_t h={ 0 };
+	const obsd_t *data;
+	const int hr=msm>=6,ext=msm==5||msm==7; /* high resolution, extended info and rate */
+	const double psunit=hr ? P2_29 : P2_24,phunit=hr ? P2_31 : P2_29;
+	const int psmax=hr ? 524287 : 16383,phmax=hr ? 8388607 : 2097151;
+	unsigned char satmask[64]={ 0 },sigmask[32]={ 0 },id;
+	double rrng[64],rrate[64],wls[64],wl,d,*cpo;
+	int i,j,k,q,prn,fcn,freq,ncell=0,idat[64],ex[64],cellj[64],celli[64];
+	int rng[64],rng_m[64],rate[64],psr[64],phr[64],lock[64],half[64],cnr[64],rrf[64];
+	bitwr_t bw(buff,24);
+
+	if ((q=sys2msm(sys))<0) return 0;
+
+	/* satellite and signal mask */
+	for (i=0; i<64; i++) idat[i]=-1;
+	for (i=0; i<obs->n; i++) {
+		data=&obs->data[i];
+		if (satsys(data->sat,&prn)!=sys) continue;
+		if (sys==SYS_GLO) prn-=MINPRNGLO-1;
+		else if (sys==SYS_QZS) prn-=MINPRNQZS-1;
+		else if (sys==SYS_SBS) prn-=MINPRNSBS-1;
+		if (prn<1||prn>64) continue;
+
+		for (j=0; j<NFREQ+NEXOBS; j++) {
+			if (!data->code[j]||!(id=msmsig[q][data->code[j]])) continue;
+			satmask[prn-1]=sigmask[id-1]=1;
+			idat[prn-1]=i;
+		}
+	}
+	for (i=0; i<32; i++) if (sigmask[i]) h.sigs[h.nsig++]=i+1;
+	for (i=0; i<64; i++) {
+		if (!satmask[i]) continue;
+		if ((h.nsat+1)*h.nsig>64) break; /* max 64 cells */
+		idat[h.nsat]=idat[i];
+		h.sats[h.nsat++]=i+1;
+	}
+	if (h.nsat<=0) return 0;
+
+	/* cell mask and rough range/range-rate of satellites */
+	for (i=0; i<h.nsat; i++) {
+		data=&obs->data[idat[i]];
+		fcn=sys==SYS_GLO ? glofcn(h.sats[i]) : 0;
+		ex[i]=sys==SYS_GLO ? (fcn>=-7 ? fcn+7 : 15) : 0;
+		rrng[i]=rrate[i]=0.0;
+
+		for (k=0; k<h.nsig; k++) {
+			h.cellmask[k+i*h.nsig]=0;
+			for (j=0; j<NFREQ+NEXOBS; j++) {
+				if (data->code[j]&&msmsig[q][data->code[j]]==h.sigs[k]) break;
+			}
+			if (j>=NFREQ+NEXOBS) continue;
+			h.cellmask[k+i*h.nsig]=1;
+			celli[ncell]=i; cellj[ncell++]=j;
+
+			/* signal wave length */
+			freq=codefrq[data->code[j]];
+			if (sys==SYS_CMP) {
+				if (freq==5) freq=2; /* B2 */
+				else if (freq==4) freq=3; /* B3 */
+			}
+			if (sys==SYS_GLO) {
+				wl=fcn<-7 ? 0.0 : CLIGHT/((freq==2 ? FREQ2_GLO : FREQ1_GLO)+
+					(freq==2 ? DFRQ2_GLO : DFRQ1_GLO)*fcn);
+			}
+			else wl=satwavelen(data->sat,freq-1,nav);
+
+			if (rrng[i]==0.0&&data->P[j]!=0.0) rrng[i]=data->P[j];
+			if (rrate[i]==0.0&&data->D[j]!=0.0&&wl>0.0) rrate[i]=-data->D[j]*wl;
+			wls[ncell-1]=wl;
+		}
+		/* rough range in 1/1024 ms */
+		k=ROUND(rrng[i]/RANGE_MS/P2_10);
+		if (rrng[i]<=0.0||k>=255*1024) {
+			rng[i]=255; rng_m[i]=0; rrng[i]=0.0;
+		}
+		else {
+			rng[i]=k>>10; rng_m[i]=k&0x3FF; rrng[i]=k*P2_10*RANGE_MS;
+		}
+		/* rough range-rate (m/s) */
+		rate[i]=rrate[i]!=0.0&&fabs(rrate[i])<8191.5 ? ROUND(rrate[i]) : -8192;
+	}
+	/* signal data */
+	for (k=0; k<ncell; k++) {
+		i=celli[k]; j=cellj[k];
+		data=&obs->data[idat[i]];
+		wl=wls[k];
+		cpo=&cp[data->sat-1][j];
+
+		psr[k]=-psmax-1; phr[k]=-phmax-1; rrf[k]=-16384; /* invalid values */
+
+		if (rrng[i]!=0.0&&data->P[j]!=0.0) {
+			d=(data->P[j]-rrng[i])/RANGE_MS/psunit;
+			if (fabs(d)<=psmax) psr[k]=ROUND(d);
+		}
+		if (rrng[i]!=0.0&&data->L[j]!=0.0&&wl>0.0) {
+			d=data->L[j]*wl-rrng[i];
+
+			/* subtract integer cycles of phase-range offset (reset at slip or overflow) */
+			if ((data->LLI[j]&1)||fabs(d-*cpo)>1171.0) {
+				*cpo=ROUND(d/wl)*wl;
+				lltime[data->sat-1][j]=data->time;
+			}
+			d=(d-*cpo)/RANGE_MS/phunit;
+			if (fabs(d)<=phmax) phr[k]=ROUND(d);
+		}
+		if (ext&&rate[i]!=-8192&&data->D[j]!=0.0&&wl>0.0) {
+			d=(-data->D[j]*wl-rate[i])/0.0001;
+			if (fabs(d)<=16383.0) rrf[k]=ROUND(d);
+		}
+		d=locktime(data,j);
+		lock[k]=hr ? to_msm_lock_ex(d) : to_msm_lock(d);
+		half[k]=(data->LLI[j]&2) ? 1 : 0;
+		cnr[k]=hr ? data->SNR[j]*4 : ROUND(data->SNR[j]*0.25);
+		if (cnr[k]>(hr ? 1023 : 63)) cnr[k]=hr ? 1023 : 63;
+	}
+	/* encode msm header */
+	encode_msm_head(bw,type,sys,sync,&h);
+
+	/* encode satellite data */
+	for (i=0; i<h.nsat; i++) bw.setu(8,rng[i]);
+	if (ext) for (i=0; i<h.nsat; i++) bw.setu(4,ex[i]);
+	for (i=0; i<h.nsat; i++) bw.setu(10,rng_m[i]);
+	if (ext) for (i=0; i<h.nsat; i++) bw.sets(14,rate[i]);
+
+	/* encode signal data */
+	for (k=0; k<ncell; k++) bw.sets(hr ? 20 : 15,psr[k]);
+	for (k=0; k<ncell; k++) bw.sets(hr ? 24 : 22,phr[k]);
+	for (k=0; k<ncell; k++) bw.setu(hr ? 10 :  4,lock[k]);
+	for (k=0; k<ncell; k++) bw.setu(1,half[k]);
+	for (k=0; k<ncell; k++) bw.setu(hr ? 10 :  6,cnr[k]);
+	if (ext) for (k=0; k<ncell; k++) bw.sets(15,rrf[k]);
+
+	bw.flush();
+	return bw.tell();
+}
+/* set frame header and parity -------------------------------------------------------------------- */
+int rtcm3e_t::encode_frame(int nbit){
+	unsigned int crc;
+	int nbyte=(nbit-24+7)/8;
+
+	if (nbit<=24||nbyte>1023) return len=0;
+
+	buff[0]=RTCM3PREAMB;
+	buff[1]=(unsigned char)(nbyte>>8);
+	buff[2]=(unsigned char)(nbyte&0xFF);
+	crc=rtk_crc24q(buff,nbyte+3);
+	buff[nbyte+3]=(unsigned char)(crc>>16);
+	buff[nbyte+4]=(unsigned char)(crc>> 8);
+	buff[nbyte+5]=(unsigned char)(crc    );
+	return len=nbyte+6;
+}
+/* generate rtcm 3 message ---------------------------------------------------------------------------
+* generate rtcm 3 message frame from obs/nav/sta/ssr referred by encoder
+* args   : int    type      I   message type
+*          int    sync      I   synchronous message flag (1:another message follows)
+* return : length of message frame in buff (bytes) (0: no message or error)
+* notes  : before calling the function, set staid, time and input data pointer
+*          (obs for 1004/1012/msm, sta for 1005/1006, nav and ephsat for
+*          ephemerides, ssr for ssr messages)
+*
+*          supported RTCM 3 messages
+*
+*            TYPE       GPS     GLOASS    GALILEO    QZSS     BEIDOU     SBAS
+*         ----------------------------------------------------------------------
+*          OBS F-L12 : 1004      1012        -         -         -         -
+*          NAV       : 1019      1020      1045      -         1042      1019
+*                        -         -       1046        -         -         -
+*          MSM 4     : 1074      1084      1094      1114      1124      1104
+*              5     : 1075      1085      1095      1115      1125      1105
+*              6     : 1076      1086      1096      1116      1126      1106
+*              7     : 1077      1087      1097      1117      1127      1107
+*          SSR OBT   : 1057      1063      1240      1246      1258      1252
+*              CLK   : 1058      1064      1241      1247      1259      1253
+*              OBTCLK: 1060      1066      1243      1249      1261      1255
+*          ANT INFO  : 1005 1006
+*         ----------------------------------------------------------------------
+*-------------------------------------------------------------------------------------------------- */
+int rtcm3e_t::gen_rtcm3(int type,int sync){
+	int nbit=0;
+
+	len=0;
+	memset(buff,0,3);
+
+	if (((type==1004||type==1012||(1071<=type&&type<=1127))&&!obs)||
+		((type==1005||type==1006)&&!sta)||
+		((type==1019||type==1020||type==1042||type==1045||type==1046)&&
+			(!nav||ephsat<=0||ephsat>MAXSAT))||
+		(((1057<=type&&type<=1068)||(1240<=type&&type<=1263))&&!ssr)) {
+		return 0;
+	}
+	switch (type) {
+	case 1004: nbit=encode_type1004(sync);              break;
+	case 1005: nbit=encode_type1005(1005);              break;
+	case 1006: nbit=encode_type1005(1006);              break;
+	case 1012: nbit=encode_type1012(sync);              break;
+	case 1019: nbit=encode_type1019();                  break;
+	case 1020: nbit=encode_type1020();                  break;
+	case 1042: nbit=encode_type1042();                  break;
+	case 1045: nbit=encode_type1045(1045);              break;
+	case 1046: nbit=encode_type1045(1046);              break;
+	case 1057: nbit=encode_ssr(type,SYS_GPS,1,sync);    break;
+	case 1058: nbit=encode_ssr(type,SYS_GPS,2,sync);    break;
+	case 1060: nbit=encode_ssr(type,SYS_GPS,4,sync);    break;
+	case 1063: nbit=encode_ssr(type,SYS_GLO,1,sync);    break;
+	case 1064: nbit=encode_ssr(type,SYS_GLO,2,sync);    break;
+	case 1066: nbit=encode_ssr(type,SYS_GLO,4,sync);    break;
+	case 1074: nbit=encode_msm(type,SYS_GPS,4,sync);    break;
+	case 1075: nbit=encode_msm(type,SYS_GPS,5,sync);    break;
+	case 1076: nbit=encode_msm(type,SYS_GPS,6,sync);    break;
+	case 1077: nbit=encode_msm(type,SYS_GPS,7,sync);    break;
+	case 1084: nbit=encode_msm(type,SYS_GLO,4,sync);    break;
+	case 1085: nbit=encode_msm(type,SYS_GLO,5,sync);    break;
+	case 1086: nbit=encode_msm(type,SYS_GLO,6,sync);    break;
+	case 1087: nbit=encode_msm(type,SYS_GLO,7,sync);    break;
+	case 1094: nbit=encode_msm(type,SYS_GAL,4,sync);    break;
+	case 1095: nbit=encode_msm(type,SYS_GAL,5,sync);    break;
+	case 1096: nbit=encode_msm(type,SYS_GAL,6,sync);    break;
+	case 1097: nbit=encode_msm(type,SYS_GAL,7,sync);    break;
+	case 1104: nbit=encode_msm(type,SYS_SBS,4,sync);    break;
+	case 1105: nbit=encode_msm(type,SYS_SBS,5,sync);    break;
+	case 1106: nbit=encode_msm(type,SYS_SBS,6,sync);    break;
+	case 1107: nbit=encode_msm(type,SYS_SBS,7,sync);    break;
+	case 1114: nbit=encode_msm(type,SYS_QZS,4,sync);    break;
+	case 1115: nbit=encode_msm(type,SYS_QZS,5,sync);    break;
+	case 1116: nbit=encode_msm(type,SYS_QZS,6,sync);    break;
+	case 1117: nbit=encode_msm(type,SYS_QZS,7,sync);    break;
+	case 1124: nbit=encode_msm(type,SYS_CMP,4,sync);    break;
+	case 1125: nbit=encode_msm(type,SYS_CMP,5,sync);    break;
+	case 1126: nbit=encode_msm(type,SYS_CMP,6,sync);    break;
+	case 1127: nbit=encode_msm(type,SYS_CMP,7,sync);    break;
+	case 1240: nbit=encode_ssr(type,SYS_GAL,1,sync);    break;
+	case 1241: nbit=encode_ssr(type,SYS_GAL,2,sync);    break;
+	case 1243: nbit=encode_ssr(type,SYS_GAL,4,sync);    break;
+	case 1246: nbit=encode_ssr(type,SYS_QZS,1,sync);    break;
+	case 1247: nbit=encode_ssr(type,SYS_QZS,2,sync);    break;
+	case 1249: nbit=encode_ssr(type,SYS_QZS,4,sync);    break;
+	case 1252: nbit=encode_ssr(type,SYS_SBS,1,sync);    break;
+	case 1253: nbit=encode_ssr(type,SYS_SBS,2,sync);    break;
+	case 1255: nbit=encode_ssr(type,SYS_SBS,4,sync);    break;
+	case 1258: nbit=encode_ssr(type,SYS_CMP,1,sync);    break;
+	case 1259: nbit=encode_ssr(type,SYS_CMP,2,sync);    break;
+	case 1261: nbit=encode_ssr(type,SYS_CMP,4,sync);    break;
+	}
+	if (nbit<=0) return 0;
+	return encode_frame(nbit);
+}
@@ -0,0 +1,69 @@
+#ifndef RTCM3E_H
+#define RTCM3E_H
+#include "Decode/rtcm.h"
+#include "BaseFunction/bitstream.h"
+
+/* RTCM 3 encoder type ----------------------------------------------------------------------------
+* encode observation/station/ephemeris/ssr in obs_t/nav_t/sta_t to rtcm 3 frames
+* (input data are referred by pointers, message is generated in fixed buffer without allocation)
+* ------------------------------------------------------------------------------------------------ */
+class rtcm3e_t{
+	/* Constructor */
+	public:
+		rtcm3e_t();
+		~rtcm3e_t();
+	/* Implementation functions */
+	protected:
+		/* glonass frequency channel number (-7..6, -8: unknown) ------------------ */
+		int glofcn(int prn) const;
+		/* lock time (s) of signal ------------------------------------------------ */
+		double locktime(const obsd_t *data,int freq);
+		/* encode type 1001-1004 message header ----------------------------------- */
+		void encode_head1001(bitwr_t &bw,int type,int nsat,int sync);
+		/* encode type 1009-1012 message header ----------------------------------- */
+		void encode_head1009(bitwr_t &bw,int type,int nsat,int sync);
+		/* encode type 1004: extended L1&L2 gps rtk observables ------------------- */
+		int encode_type1004(int sync);
+		/* encode type 1012: extended L1&L2 glonass rtk observables --------------- */
+		int encode_type1012(int sync);
+		/* encode type 1005/1006: stationary rtk reference station arp (height) --- */
+		int encode_type1005(int type);
+		/* encode type 1019: gps ephemerides -------------------------------------- */
+		int encode_type1019();
+		/* encode type 1020: glonass ephemerides ---------------------------------- */
+		int encode_type1020();
+		/* encode type 1042: beidou ephemerides ----------------------------------- */
+		int encode_type1042();
+		/* encode type 1045/1046: galileo f/nav, i/nav ephemerides ---------------- */
+		int encode_type1045(int type);
+		/* encode ssr 1,2,4: orbit, clock, combined corrections ------------------- */
+		int encode_ssr(int type,int sys,int subtype,int sync);
+		/* encode msm message header ---------------------------------------------- */
+		void encode_msm_head(bitwr_t &bw,int type,int sys,int sync,const msm_h_t *h);
+		/* encode msm 4-7: full pseudorange and phaserange plus cnr --------------- */
+		int encode_msm(int type,int sys,int msm,int sync);
+		/* set frame header and parity -------------------------------------------- */
+		int encode_frame(int nbit);
+	public:
+		/* generate rtcm 3 message ------------------------------------------------ */
+		int gen_rtcm3(int type,int sync);
+	/* Components */
+	public:
+		int staid;						/* station id */
+		int seqno;						/* iods of msm */
+		gtime_t time;					/* message time */
+		const obs_t *obs;				/* observation data to encode */
+		const nav_t *nav;				/* navigation data to encode */
+		const sta_t *sta;				/* station parameters to encode */
+		const ssr_t *ssr;				/* ssr corrections to encode (MAXSAT) */
+		int ephsat;						/* satellite of ephemeris to encode */
+		int len;						/* length of message with parity (bytes) */
+		unsigned char buff[1200];		/* message buffer */
+	protected:
+		double cp[MAXSAT][NFREQ+NEXOBS]; /* phase-range offset of msm (m) */
+		gtime_t lltime[MAXSAT][NFREQ+NEXOBS]; /* last lock time */
+		unsigned char msmsig[6][MAXCODE+1]; /* msm signal id of obs code {G,R,E,J,S,C} */
+		unsigned char codefrq[MAXCODE+1]; /* frequency of obs code (1:L1,2:L2,...) */
+};
+
+#endif
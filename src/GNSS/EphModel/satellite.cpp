@@ -1,892 +1,1292 @@
-#include "GNSS/EphModel/satellite.h"
-
-#include "BaseFunction/basefunction.h"
-
-/* constants and macros --------------------------------------------------------------------------- */
-/* for broadcast ephemeris */
-#define SQR(x)   ((x)*(x))
-#define RE_GLO   6378136.0        /* radius of earth (m)            ref [2] */
-#define MU_GPS   3.9860050E14     /* gravitational constant         ref [1] */
-#define MU_GLO   3.9860044E14     /* gravitational constant         ref [2] */
-#define MU_GAL   3.986004418E14   /* earth gravitational constant   ref [7] */
-#define MU_CMP   3.986004418E14   /* earth gravitational constant   ref [9] */
-#define J2_GLO   1.0826257E-3     /* 2nd zonal harmonic of geopot   ref [2] */
-#define OMGE_GLO 7.292115E-5      /* earth angular velocity (rad/s) ref [2] */
-#define OMGE_GAL 7.2921151467E-5  /* earth angular velocity (rad/s) ref [7] */
-#define OMGE_CMP 7.292115E-5      /* earth angular velocity (rad/s) ref [9] */
-#define SIN_5 -0.0871557427476582 /* sin(-5.0 deg) */
-#define COS_5  0.9961946980917456 /* cos(-5.0 deg) */
-#define ERREPH_GLO 5.0            /* error of glonass ephemeris (m) */
-#define TSTEP    60.0             /* integration step glonass ephemeris (s) */
-#define RTOL_KEPLER 1E-13         /* relative tolerance for Kepler equation */
-#define DEFURASSR 0.15            /* default accurary of ssr corr (m) */
-#define MAXECORSSR 10.0           /* max orbit correction of ssr (m) */
-#define MAXCCORSSR (1E-6*CLIGHT)  /* max clock correction of ssr (m) */
-#define MAXAGESSR 90.0            /* max age of ssr orbit and clock (s) */
-#define MAXAGESSR_HRCLK 10.0      /* max age of ssr high-rate clock (s) */
-#define STD_BRDCCLK 30.0          /* error of broadcast clock (m) */
-#define MAX_ITER_KEPLER 30        /* max number of iteration of Kelpler */
-/* for precise ephemeris */
-#define NMAX        10              /* order of polynomial interpolation */
-#define MAXDTE      900.0           /* max time difference to ephem time (s) */
-#define EXTERR_CLK  1E-3            /* extrapolation error for clock (m/s) */
-#define EXTERR_EPH  5E-7            /* extrapolation error for ephem (m/s^2) */
-/* for qzss lex ephemeris */
-#define LEXEPHMAXAGE    360.0           /* max age of lex ephemeris (s) */
-
-static const double ura_eph[]={         /* ura values (ref [3] 20.3.3.3.1.1) */
-	2.4,3.4,4.85,6.85,9.65,13.65,24.0,48.0,96.0,192.0,384.0,768.0,1536.0,
-	3072.0,6144.0,0.0
-};
-static const double ura_nominal[]={     /* ura nominal values */
-	2.0,2.8,4.0,5.7,8.0,11.3,16.0,32.0,64.0,128.0,256.0,512.0,1024.0,
-	2048.0,4096.0,8192.0
-};
-
-/* satellite functions ---------------------------------------------------------------------------- */
-/* parent class of satellite functions ------------------------------------------------------------ */
-/* Constructors ------------------------------------------------------------------- */
-satellite_t::satellite_t(){
-}
-satellite_t::~satellite_t(){
-	satantfunc=NULL;
-}
-/* Implementation functions ------------------------------------------------------- */
-int satellite_t::satclk(obsd_t *data,const nav_t *nav){
-	return 0;
-}
-int satellite_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	return 0;
-}
-/* compute satellite positions and clocks ----------------------------------------- */
-int satellite_t::satposclk(obs_t *obs,const nav_t *nav){
-	int num=0;
-
-	for (int i=0;i<obs->n&&i<MAXOBS;i++){
-		/* reset satellite data of observation */
-		obs->data[i].satreset();
-
-		/* search any psuedorange */
-		if (obs->data[i].sigtime_opsr()!=1) continue;
-
-		/* satellite clock bias to correct signal time */
-		if (!satclk(&obs->data[i],nav)) {
-			obs->data[i].errmsg = "no satellite clock bias!";
-			continue;
-		}
-		obs->data[i].sigtime_sclk();
-
-		if (!satpos(&obs->data[i],999,nav)){
-			obs->data[i].errmsg = "no ephemeris!";
-			continue;
-		}
-		if (obs->data[i].svh!=-1) num++;
-	}
-	/* end */
-	return num;
-}
-
-/* subclass of satellite functions ---------------------------------------------------------------- */
-/* broadcast ephemeris ---------------------------------------------------------------------------- */
-/* Constructors ------------------------------------------------------------------- */
-broadcast_t::broadcast_t(){
-}
-broadcast_t::~broadcast_t(){
-}
-/* Implementation functions ------------------------------------------------------- */
-/* broadcast functions ------------------------------------------------------------ */
-
-/* variance by ura ephemeris (ref [1] 20.3.3.3.1.1) ------------------------------- */
-double broadcast_t::var_uraeph(int ura)
-{
-	return ura<0||15<ura ? SQR(8192.0) : SQR(ura_nominal[ura]);
-}
-/* variance by ura ssr (ref [4]) -------------------------------------------------- */
-double broadcast_t::var_urassr(int ura)
-{
-	double std;
-	if (ura<= 0) return SQR(DEFURASSR);
-	if (ura>=63) return SQR(5.4665);
-	std=(pow(3.0,(ura>>3)&7)*(1.0+(ura&7)/4.0)-1.0)*1E-3;
-	return SQR(std);
-}
-/* glonass orbit differential equations ------------------------------------------- */
-void broadcast_t::deq(const double *x,double *xdot,const double *acc)
-{
-	double a,b,c,r2=dot(x,x,3),r3=r2*sqrt(r2),omg2=SQR(OMGE_GLO);
-
-	if (r2<=0.0) {
-		xdot[0]=xdot[1]=xdot[2]=xdot[3]=xdot[4]=xdot[5]=0.0;
-		return;
-	}
-	/* ref [2] A.3.1.2 with bug fix for xdot[4],xdot[5] */
-	a=1.5*J2_GLO*MU_GLO*SQR(RE_GLO)/r2/r3; /* 3/2*J2*mu*Ae^2/r^5 */
-	b=5.0*x[2]*x[2]/r2;                    /* 5*z^2/r^2 */
-	c=-MU_GLO/r3-a*(1.0-b);                /* -mu/r^3-a(1-b) */
-	xdot[0]=x[3]; xdot[1]=x[4]; xdot[2]=x[5];
-	xdot[3]=(c+omg2)*x[0]+2.0*OMGE_GLO*x[4]+acc[0];
-	xdot[4]=(c+omg2)*x[1]-2.0*OMGE_GLO*x[3]+acc[1];
-	xdot[5]=(c-2.0*a)*x[2]+acc[2];
-}
-/* glonass position and velocity by numerical integration ------------------------- */
-void broadcast_t::glorbit(double t,double *x,const double *acc)
-{
-	double k1[6],k2[6],k3[6],k4[6],w[6];
-	int i;
-
-	deq(x,k1,acc); for (i=0; i<6; i++) w[i]=x[i]+k1[i]*t/2.0;
-	deq(w,k2,acc); for (i=0; i<6; i++) w[i]=x[i]+k2[i]*t/2.0;
-	deq(w,k3,acc); for (i=0; i<6; i++) w[i]=x[i]+k3[i]*t;
-	deq(w,k4,acc);
-	for (i=0; i<6; i++) x[i]+=(k1[i]+2.0*k2[i]+2.0*k3[i]+k4[i])*t/6.0;
-}
-/* select GPS/GAL/QZS/CMP ephemeris ----------------------------------------------- */
-int broadcast_t::seleph(obsd_t *data,int iode,const nav_t *nav){
-	double t,tmax,tmin;
-	int neph=-1;
-
-	switch (satsys(data->sat,NULL)){
-		case SYS_QZS: tmax=MAXDTOE_QZS+1.0; break;
-		case SYS_GAL: tmax=MAXDTOE_GAL+1.0; break;
-		case SYS_CMP: tmax=MAXDTOE_CMP+1.0; break;
-		default: tmax=MAXDTOE+1.0; break;
-		}
-	tmin=tmax+1.0;
-
-	for (int i=0; i<nav->n; i++) {
-		if (nav->eph[i].sat!=data->sat) continue;
-		if (iode>=0&&nav->eph[i].iode!=iode) continue;
-		if ((t=fabs(nav->eph[i].toe.timediff(data->time)))>tmax) continue;
-		if (iode>=0) return i;
-		if (t<=tmin) { neph=i; tmin=t; } /* toe closest to time */
-	}
-	if (iode>=0||neph<0) { 
-		data->errmsg="no broadcast ephemeris!";
-		return -1;
-	}
-	return neph;
-}
-/* select GLO ephemeris ----------------------------------------------------------- */
-int broadcast_t::selgeph(obsd_t *data, int iode, const nav_t *nav){
-	double t,tmax=MAXDTOE_GLO,tmin=tmax+1.0;
-	int ngeph=-1;
-
-	for (int i=0; i<nav->ng; i++) {
-		if (nav->geph[i].sat!=data->sat) continue;
-		if (iode>=0&&nav->geph[i].iode!=iode) continue;
-		if ((t=fabs(nav->geph[i].toe.timediff(data->time)))>tmax) continue;
-		if (iode>=0) return i;
-		if (t<=tmin) { ngeph=i; tmin=t; } /* toe closest to time */
-	}
-	if (iode>=0||ngeph<0) {
-		data->errmsg="no glonass broadcast ephemeris!";
-		return -1;
-	}
-	return ngeph;
-}
-/* select SBS ephemeris ----------------------------------------------------------- */
-int broadcast_t::selseph(obsd_t *data,const nav_t *nav){
-	double t,tmax=MAXDTOE_SBS,tmin=tmax+1.0;
-	int nseph=-1;
-
-	for (int i=0; i<nav->ns; i++) {
-		if (nav->seph[i].sat!=data->sat) continue;
-		if ((t=fabs(nav->seph[i].t0.timediff(data->time)))>tmax) continue;
-		if (t<=tmin) { nseph=i; tmin=t; } /* toe closest to time */
-	}
-	if (nseph<0) {
-		data->errmsg="no SBS broadcast ephemeris!";
-		return -1;
-	}
-	return nseph;
-}
-/* position functions ------------------------------------------------------------- */
-/* position from GPS/GAL/QZS/CMP ephemeris ---------------------------------------- */
-void broadcast_t::eph2pos(obsd_t *data,const eph_t eph){
-	double tk,M,E,Ek,sinE,cosE,u,r,i,O,sin2u,cos2u,x,y,sinO,cosO,cosi,mu,omge;
-	double xg,yg,zg,sino,coso;
-	int n,sys,prn;
-
-	if (eph.A<=0.0) {
-		data->satreset();
-		return;
-	}
-	tk=data->sigtime.timediff(eph.toe);
-
-	switch ((sys=satsys(eph.sat,&prn))) {
-	case SYS_GAL: mu=MU_GAL; omge=OMGE_GAL; break;
-	case SYS_CMP: mu=MU_CMP; omge=OMGE_CMP; break;
-	default:      mu=MU_GPS; omge=OMGE;     break;
-	}
-	M=eph.M0+(sqrt(mu/(eph.A*eph.A*eph.A))+eph.deln)*tk;
-
-	for (n=0,E=M,Ek=0.0; fabs(E-Ek)>RTOL_KEPLER&&n<MAX_ITER_KEPLER; n++) {
-		Ek=E; E-=(E-eph.e*sin(E)-M)/(1.0-eph.e*cos(E));
-	}
-	if (n>=MAX_ITER_KEPLER) {
-		return;
-	}
-	sinE=sin(E); cosE=cos(E);
-
-	u=atan2(sqrt(1.0-eph.e*eph.e)*sinE,cosE-eph.e)+eph.omg;
-	r=eph.A*(1.0-eph.e*cosE);
-	i=eph.i0+eph.idot*tk;
-	sin2u=sin(2.0*u); cos2u=cos(2.0*u);
-	u+=eph.cus*sin2u+eph.cuc*cos2u;
-	r+=eph.crs*sin2u+eph.crc*cos2u;
-	i+=eph.cis*sin2u+eph.cic*cos2u;
-	x=r*cos(u); y=r*sin(u); cosi=cos(i);
-
-	/* beidou geo satellite (ref [9]) */
-	if (sys==SYS_CMP&&prn<=5) {
-		O=eph.OMG0+eph.OMGd*tk-omge*eph.toes;
-		sinO=sin(O); cosO=cos(O);
-		xg=x*cosO-y*cosi*sinO;
-		yg=x*sinO+y*cosi*cosO;
-		zg=y*sin(i);
-		sino=sin(omge*tk); coso=cos(omge*tk);
-		data->posvel[0]= xg*coso+yg*sino*COS_5+zg*sino*SIN_5;
-		data->posvel[1]=-xg*sino+yg*coso*COS_5+zg*coso*SIN_5;
-		data->posvel[2]=-yg*SIN_5+zg*COS_5;
-	}
-	else {
-		O=eph.OMG0+(eph.OMGd-omge)*tk-omge*eph.toes;
-		sinO=sin(O); cosO=cos(O);
-		data->posvel[0]=x*cosO-y*cosi*sinO;
-		data->posvel[1]=x*sinO+y*cosi*cosO;
-		data->posvel[2]=y*sin(i);
-	}
-	tk=data->sigtime.timediff(eph.toc);
-	data->dts[0]=eph.f0+eph.f1*tk+eph.f2*tk*tk;
-
-	/* relativity correction */
-	data->dts[0]-=2.0*sqrt(mu*eph.A)*eph.e*sinE/SQR(CLIGHT);
-
-	/* position and clock error variance */
-	data->svar=var_uraeph(eph.sva);
-}
-/* position bias from GLO ephemeris ----------------------------------------------- */
-void broadcast_t::geph2pos(obsd_t *data,const geph_t geph){
-	double t,tt,x[6];
-	int i;
-
-	t=data->sigtime.timediff(geph.toe);
-
-	data->dts[0]=-geph.taun+geph.gamn*t;
-
-	for (i=0; i<3; i++) {
-		x[i]=geph.pos[i];
-		x[i+3]=geph.vel[i];
-	}
-	for (tt=t<0.0 ? -TSTEP : TSTEP; fabs(t)>1E-9; t-=tt) {
-		if (fabs(t)<TSTEP) tt=t;
-		glorbit(tt,x,geph.acc);
-	}
-	for (i=0; i<3; i++) data->posvel[i]=x[i];
-
-	data->svar=SQR(ERREPH_GLO);
-}
-/* position bias from SBS ephemeris ----------------------------------------------- */
-void broadcast_t::seph2pos(obsd_t *data,const seph_t seph){
-	double t;
-	int i;
-
-	t=data->sigtime.timediff(seph.t0);
-
-	for (i=0; i<3; i++) {
-		data->posvel[i]=seph.pos[i]+seph.vel[i]*t+seph.acc[i]*t*t/2.0;
-	}
-	data->dts[0]=seph.af0+seph.af1*t;
-
-	data->svar=var_uraeph(seph.sva);
-}
-/* clock functions ---------------------------------------------------------------- */
-/* clock bias from GPS/GAL/QZS/CMP ephemeris -------------------------------------- */
-void broadcast_t::eph2clk(obsd_t *data,const eph_t eph){
-	double t;
-
-	t=data->sigtime.timediff(eph.toc);
-
-	for (int i=0; i<2; i++) {
-		t-=eph.f0+eph.f1*t+eph.f2*t*t;
-	}
-	data->dts[0]=eph.f0+eph.f1*t+eph.f2*t*t;
-}
-/* clock bias from GLO ephemeris -------------------------------------------------- */
-void broadcast_t::geph2clk(obsd_t *data,const geph_t geph){
-	double t;
-
-	t=data->sigtime.timediff(geph.toe);
-
-	for (int i=0; i<2; i++) {
-		t-=-geph.taun+geph.gamn*t;
-	}
-	data->dts[0]=-geph.taun+geph.gamn*t;
-}
-/* clock bias from SBS ephemeris -------------------------------------------------- */
-void broadcast_t::seph2clk(obsd_t *data,const seph_t seph){
-	double t;
-
-	t=data->sigtime.timediff(seph.t0);
-
-	for (int i=0; i<2; i++) {
-		t-=seph.af0+seph.af1*t;
-	}
-	data->dts[0]=seph.af0+seph.af1*t;
-}
-/* broadcast satellite position function ------------------------------------------ */
-int broadcast_t::broadpos(obsd_t *data,int iode,const nav_t *nav){
-	obsd_t d1E_3;
-	/* satellite system */
-	int sys=satsys(data->sat,NULL);
-	data->svh=-1;
-
-	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP){
-		int neph=seleph(data,iode,nav);
-		if (neph>=0) eph2pos(data,nav->eph[neph]);
-		else return 0;
-		d1E_3.sigtime=data->sigtime; d1E_3.sigtime.timeadd(1E-3);
-		eph2pos(&d1E_3,nav->eph[neph]);
-		if (data->svar<129.0) data->svh = nav->eph[neph].svh;
-	}
-	else if (sys==SYS_GLO){
-		int ngeph=selgeph(data,iode,nav);
-		if (ngeph>=0) geph2pos(data,nav->geph[ngeph]);
-		else return 0;
-		d1E_3.sigtime=data->sigtime; d1E_3.sigtime.timeadd(1E-3);
-		geph2pos(&d1E_3,nav->geph[ngeph]);
-		data->svh=nav->geph[ngeph].svh;
-	}
-	else if (sys==SYS_SBS){
-		int nseph=selseph(data,nav);
-		if (nseph>=0) seph2pos(data,nav->seph[nseph]);
-		else return 0;
-		d1E_3.sigtime=data->sigtime; d1E_3.sigtime.timeadd(1E-3);
-		seph2pos(&d1E_3,nav->seph[nseph]);
-		if (data->svar<129.0) data->svh=nav->seph[nseph].svh;
-	}
-	else return 0;
-
-	/* satellite velocity and clock drift by differential approx */
-	for (int i=0; i<3; i++) data->posvel[i+3]=(d1E_3.posvel[i]-data->posvel[i])/1E-3;
-	data->dts[1]=(d1E_3.dts[0]-data->dts[0])/1E-3;
-
-	/* no satellite antenna offset correction becasue broadcast navigation ephemeris
-	 * refer to the antenna phase center of satellite */
-
-	return 1;
-}
-/* broadcast satellite clocks function -------------------------------------------- */
-int broadcast_t::satclk(obsd_t *data,const nav_t *nav){
-	/* satellite system */
-	int sys=satsys(data->sat,NULL);
-	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP){
-		int neph = seleph(data,-1,nav);
-		if (neph>=0) eph2clk(data,nav->eph[neph]);
-		else return 0;
-	}
-	else if (sys==SYS_GLO){
-		int ngeph = selgeph(data,-1,nav);
-		if (ngeph>=0) geph2clk(data,nav->geph[ngeph]);
-		else return 0;
-	}
-	else if (sys==SYS_SBS){
-		int nseph = selseph(data,nav);
-		if (nseph>=0) seph2clk(data,nav->seph[nseph]);
-		else return 0;
-	}
-	else return 0;
-	
-	return 1;
-}
-/* broadcast satellite position function called by satposclk() ------------ */
-int broadcast_t::satpos(obsd_t *data,int flag,const nav_t *nav){
-	data->svh=0;
-	return broadpos(data,-1,nav);
-}
-
-
-/* broadcast ephemeris with sbas correction ------------------------------------------------------- */
-/* Constructors ------------------------------------------------------------------- */
-broadsbas_t::broadsbas_t(){
-}
-broadsbas_t::~broadsbas_t(){
-}
-/* Implementation functions -------------------------------------------------------- */
-/* broadcast satellite position function with sbas correction ---------------------- */
-int broadsbas_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	int nsbas;
-	/* search sbas satellite correciton */
-	for (nsbas=0; nsbas<nav->sbssat.nsat; nsbas++) 
-		if (nav->sbssat.sat[nsbas].sat==data->sat) break;
-	if (nsbas>=nav->sbssat.nsat){
-		broadpos(data,-1,nav);
-		data->svh=-1;
-		return 0;
-	}
-	/* satellite postion and clock from broadcast ephemeris */
-	if (!broadpos(data,nav->sbssat.sat[nsbas].lcorr.iode,nav)) return 0;
-	if (nav->sbssat.sbssatcorr(data)) return 1;
-	data->svh=-1;
-	return 0;
-}
-
-/* broadcast ephemeris with ssr_apc correction ---------------------------------------------------- */
-/* Constructors ------------------------------------------------------------------- */
-broadssrapc_t::broadssrapc_t(){
-}
-broadssrapc_t::~broadssrapc_t(){
-}
-/* base functions ----------------------------------------------------------------- */
-/* broadcast satellite position function with ssr_apc correction ------------------ */
-int broadssrapc_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	/* pointer to the ssr_t in nav */
-	const ssr_t *ssr=nav->ssr+data->sat-1;
-	/* satellite system */
-	int sys=satsys(data->sat,NULL);
-	int neph=-1;
-	double t1,t2,t3,er[3],ea[3],ec[3],rc[3],deph[3],dclk,dant[3]={ 0 },tk;
-
-
-	if (!ssr->t0[0].time) {
-		return 0;
-	}
-	if (!ssr->t0[1].time) {
-		return 0;
-	}
-	/* inconsistency between orbit and clock correction */
-	if (ssr->iod[0]!=ssr->iod[1]) {
-		data->svh=-1;
-		return 0;
-	}
-	t1=data->sigtime.timediff(ssr->t0[0]);
-	t2=data->sigtime.timediff(ssr->t0[1]);
-	t3=data->sigtime.timediff(ssr->t0[2]);
-
-	/* ssr orbit and clock correction (ref [4]) */
-	if (fabs(t1)>MAXAGESSR||fabs(t2)>MAXAGESSR) {
-		data->svh=-1;
-		return 0;
-	}
-	if (ssr->udi[0]>=1.0) t1-=ssr->udi[0]/2.0;
-	if (ssr->udi[1]>=1.0) t2-=ssr->udi[0]/2.0;
-
-	for (int i=0; i<3; i++) deph[i]=ssr->deph[i]+ssr->ddeph[i]*t1;
-	dclk=ssr->dclk[0]+ssr->dclk[1]*t2+ssr->dclk[2]*t2*t2;
-
-	/* ssr highrate clock correction (ref [4]) */
-	if (ssr->iod[0]==ssr->iod[2]&&ssr->t0[2].time&&fabs(t3)<MAXAGESSR_HRCLK) {
-		dclk+=ssr->hrclk;
-	}
-	if (norm(deph,3)>MAXECORSSR||fabs(dclk)>MAXCCORSSR) {
-		data->svh=-1;
-		return 0;
-	}
-	/* satellite postion and clock by broadcast ephemeris */
-	if (!broadpos(data,ssr->iode,nav)) return 0;
-
-	/* satellite clock for gps, galileo and qzss */
-	sys=satsys(data->sat,NULL);
-	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP) {
-		if ((neph=seleph(data,ssr->iode,nav))<0) return 0;
-
-		/* satellite clock by clock parameters */
-		tk=data->sigtime.timediff(nav->eph[neph].toc);
-		data->dts[0]=nav->eph[neph].f0+nav->eph[neph].f1*tk+nav->eph[neph].f2*tk*tk;
-		data->dts[1]=nav->eph[neph].f1+2.0*nav->eph[neph].f2*tk;
-
-		/* relativity correction */
-		data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
-	}
-	/* radial-along-cross directions in ecef */
-	if (!normv3(data->posvel+3,ea)) return 0;
-	cross3(data->posvel,data->posvel+3,rc);
-	if (!normv3(rc,ec)) {
-		data->svh=-1;
-		return 0;
-	}
-	cross3(ea,ec,er);
-
-	/* satellite antenna offset correction */
-	for (int i=0; i<3; i++) {
-		data->posvel[i]+=-(er[i]*deph[0]+ea[i]*deph[1]+ec[i]*deph[2])+dant[i];
-	}
-	/* t_corr = t_sv - (dts(brdc) + dclk(ssr) / CLIGHT) (ref [10] eq.3.12-7) */
-	data->dts[0]+=dclk/CLIGHT;
-
-	/* variance by ssr ura */
-	data->svar=var_urassr(ssr->ura);
-
-	return 1;
-}
-/* broadcast ephemeris with ssr_com correction ---------------------------------------------------- */
-/* Constructors ------------------------------------------------------------------- */
-broadssrcom_t::broadssrcom_t(){
-}
-broadssrcom_t::~broadssrcom_t(){
-}
-/* base functions ----------------------------------------------------------------- */
-/* broadcast satellite position function with ssr_com correction ------------------ */
-int broadssrcom_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	/* pointer to the ssr_t in nav */
-	const ssr_t *ssr=nav->ssr+data->sat-1;
-	/* satellite system */
-	int sys=satsys(data->sat,NULL);
-	int neph=-1;
-	double t1,t2,t3,er[3],ea[3],ec[3],rc[3],deph[3],dclk,dant[3]={ 0 },tk;
-
-
-	if (!ssr->t0[0].time) {
-		return 0;
-	}
-	if (!ssr->t0[1].time) {
-		return 0;
-	}
-	/* inconsistency between orbit and clock correction */
-	if (ssr->iod[0]!=ssr->iod[1]) {
-		data->svh=-1;
-		return 0;
-	}
-	t1=data->sigtime.timediff(ssr->t0[0]);
-	t2=data->sigtime.timediff(ssr->t0[1]);
-	t3=data->sigtime.timediff(ssr->t0[2]);
-
-	/* ssr orbit and clock correction (ref [4]) */
-	if (fabs(t1)>MAXAGESSR||fabs(t2)>MAXAGESSR) {
-		data->svh=-1;
-		return 0;
-	}
-	if (ssr->udi[0]>=1.0) t1-=ssr->udi[0]/2.0;
-	if (ssr->udi[1]>=1.0) t2-=ssr->udi[0]/2.0;
-
-	for (int i=0; i<3; i++) deph[i]=ssr->deph[i]+ssr->ddeph[i]*t1;
-	dclk=ssr->dclk[0]+ssr->dclk[1]*t2+ssr->dclk[2]*t2*t2;
-
-	/* ssr highrate clock correction (ref [4]) */
-	if (ssr->iod[0]==ssr->iod[2]&&ssr->t0[2].time&&fabs(t3)<MAXAGESSR_HRCLK) {
-		dclk+=ssr->hrclk;
-	}
-	if (norm(deph,3)>MAXECORSSR||fabs(dclk)>MAXCCORSSR) {
-		data->svh=-1;
-		return 0;
-	}
-	/* satellite postion and clock by broadcast ephemeris */
-	if (!broadpos(data,ssr->iode,nav)) return 0;
-
-	/* satellite clock for gps, galileo and qzss */
-	sys=satsys(data->sat,NULL);
-	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP) {
-		if ((neph=seleph(data,ssr->iode,nav))<0) return 0;
-
-		/* satellite clock by clock parameters */
-		tk=data->sigtime.timediff(nav->eph[neph].toc);
-		data->dts[0]=nav->eph[neph].f0+nav->eph[neph].f1*tk+nav->eph[neph].f2*tk*tk;
-		data->dts[1]=nav->eph[neph].f1+2.0*nav->eph[neph].f2*tk;
-
-		/* relativity correction */
-		data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
-	}
-	/* radial-along-cross directions in ecef */
-	if (!normv3(data->posvel+3,ea)) return 0;
-	cross3(data->posvel,data->posvel+3,rc);
-	if (!normv3(rc,ec)) {
-		data->svh=-1;
-		return 0;
-	}
-	cross3(ea,ec,er);
-
-	/* satellite antenna offset correction */
-	satantfunc->satantoff(data,nav);
-
-	for (int i=0; i<3; i++) {
-		data->posvel[i]+=-(er[i]*deph[0]+ea[i]*deph[1]+ec[i]*deph[2]);
-	}
-	/* t_corr = t_sv - (dts(brdc) + dclk(ssr) / CLIGHT) (ref [10] eq.3.12-7) */
-	data->dts[0]+=dclk/CLIGHT;
-
-	/* variance by ssr ura */
-	data->svar=var_urassr(ssr->ura);
-
-	return 1;
-}
-
-/* precise ephemeris ------------------------------------------------------------------------------ */
-/* Constg */
-/* Constructors ------------------------------------------------------------------- */
-preciseph_t::preciseph_t(){
-}
-preciseph_t::~preciseph_t(){
-}
-/* Implementation functions ------------------------------------------------------- */
-/* base precise ephemeris functions ----------------------------------------------- */
-/* polynomial interpolation by Lagrange's algorithm (time interpolation) -- */
-double preciseph_t::interpolLaR(const double *dt,gtime_t *ptime,const double *ppos,
-	int n){
-	int i,j;
-	double item=1.0,value=0.0;
-
-	for (i=0; i<n; i++) {
-		item=1.0;
-		for (j=0; j<i; j++) item*=dt[j]/ptime[j].timediff(ptime[i]);
-		for (j=i+1; j<n; j++) item*=dt[j]/ptime[j].timediff(ptime[i]);
-		item*=ppos[i];
-		value+=item;
-	}
-
-	return value;
-}
-/* precise satellite position of one epoch -------------------------------------------
-* use 9 orders Lagrange interpolation
------------------------------------------------------------------------------------ */
-int preciseph_t::precisepos(obsd_t *data,const nav_t *nav){
-	gtime_t TNMAX[NMAX];
-	double t[NMAX],p[3][NMAX],c[2],std=0.0,s[3],sinl,cosl;
-	int i,j,k,index;
-
-	data->posvel[0]=data->posvel[1]=data->posvel[2]=data->dts[0]=0.0;
-
-	if (nav->ne<NMAX||
-		data->sigtime.timediff(nav->peph[0].time)<-MAXDTE||
-		data->sigtime.timediff(nav->peph[nav->ne-1].time)>MAXDTE) {
-		data->errmsg="no percise ephemeris!";
-		return 0;
-	}
-	/* binary search */
-	for (i=0,j=nav->ne-1; i<j;) {
-		k=(i+j)/2;
-		if (nav->peph[k].time.timediff(data->sigtime)<0.0) i=k+1; else j=k;
-	}
-	index=i<=0 ? 0 : i-1;
-
-	/* polynomial interpolation for orbit */
-	i=index+1-(NMAX)/2;
-	if (i<0) i=0; else if (i+NMAX>nav->ne) i=nav->ne-NMAX;
-
-	for (j=0; j<NMAX; j++) {
-		t[j]=nav->peph[i+j].time.timediff(data->sigtime);
-		TNMAX[j]=nav->peph[i+j].time;
-		if (norm(nav->peph[i+j].pos[data->sat-1],3)<=0.0) {
-			return 0;
-		}
-	}
-	for (j=0; j<NMAX; j++) {
-#if 0
-		p[0][j]=pos[0];
-		p[1][j]=pos[1];
-#else
-		/* correciton for earh rotation ver.2.4.0 */
-		sinl=sin(OMGE*t[j]);
-		cosl=cos(OMGE*t[j]);
-		p[0][j]=
-			cosl*nav->peph[i+j].pos[data->sat-1][0]-sinl*nav->peph[i+j].pos[data->sat-1][1];
-		p[1][j]=
-			sinl*nav->peph[i+j].pos[data->sat-1][0]+cosl*nav->peph[i+j].pos[data->sat-1][1];
-#endif
-		p[2][j]=nav->peph[i+j].pos[data->sat-1][2];
-	}
-	for (i=0; i<3; i++) {
-		data->posvel[i]=interpolLaR(t,TNMAX,p[i],NMAX);
-	}
-
-	/* satellite position variance */
-	for (i=0; i<3; i++) s[i]=nav->peph[index].std[data->sat-1][i];
-	std=norm(s,3);
-	if (t[0]>0.0) std+=EXTERR_EPH*SQR(t[0])/2.0; /* extrapolation error for orbit */
-	else if (t[NMAX-1]<0.0) std+=EXTERR_EPH*SQR(t[NMAX-1])/2.0;
-	data->svar=SQR(std);
-
-	/* linear interpolation for clock */
-	t[0]=data->sigtime.timediff(nav->peph[index].time);
-	t[1]=data->sigtime.timediff(nav->peph[index+1].time);
-	c[0]=nav->peph[index].pos[data->sat-1][3];
-	c[1]=nav->peph[index+1].pos[data->sat-1][3];
-
-	if (t[0]<=0.0) {
-		if ((data->dts[0]=c[0])!=0.0) {
-			std=nav->peph[index].std[data->sat-1][3]*CLIGHT-EXTERR_CLK*t[0];
-		}
-	}
-	else if (t[1]>=0.0) {
-		if ((data->dts[0]=c[1])!=0.0) {
-			std=nav->peph[index+1].std[data->sat-1][3]*CLIGHT+EXTERR_CLK*t[1];
-		}
-	}
-	else if (c[0]!=0.0&&c[1]!=0.0) {
-		data->dts[0]=(c[1]*t[0]-c[0]*t[1])/(t[0]-t[1]);
-		i=t[0]<-t[1] ? 0 : 1;
-		std=nav->peph[index+i].std[data->sat-1][3]+EXTERR_CLK*fabs(t[i]);
-	}
-	else {
-		data->dts[0]=0.0;
-	}
-	scvar=SQR(std);
-	return 1;
-}
-/* precise satellite clocks function ---------------------------------------------- */
-int preciseph_t::satclk(obsd_t *data,const nav_t *nav){
-	double t[2],c[2],std;
-	int i,j,k,index;
-
-	if (nav->nc<2||
-		data->sigtime.timediff(nav->pclk[0].time)<-MAXDTE||
-		data->sigtime.timediff(nav->pclk[nav->nc-1].time)>MAXDTE) {
-		data->errmsg="no precise clock!";
-		return 1;
-	}
-	/* binary search */
-	for (i=0,j=nav->nc-1; i<j;) {
-		k=(i+j)/2;
-		if (nav->pclk[k].time.timediff(data->sigtime)<0.0) i=k+1; else j=k;
-	}
-	index=i<=0 ? 0 : i-1;
-
-	/* linear interpolation for clock */
-	t[0]=data->sigtime.timediff(nav->pclk[index].time);
-	t[1]=data->sigtime.timediff(nav->pclk[index+1].time);
-	c[0]=nav->pclk[index].clk[data->sat-1];
-	c[1]=nav->pclk[index+1].clk[data->sat-1];
-
-	if (t[0]<=0.0) {
-		if ((data->dts[0]=c[0])==0.0) return 0;
-		std=nav->pclk[index].std[data->sat-1]*CLIGHT-EXTERR_CLK*t[0];
-	}
-	else if (t[1]>=0.0) {
-		if ((data->dts[0]=c[1])==0.0) return 0;
-		std=nav->pclk[index+1].std[data->sat-1]*CLIGHT+EXTERR_CLK*t[1];
-	}
-	else if (c[0]!=0.0&&c[1]!=0.0) {
-		data->dts[0]=(c[1]*t[0]-c[0]*t[1])/(t[0]-t[1]);
-		i=t[0]<-t[1] ? 0 : 1;
-		std=nav->pclk[index+i].std[data->sat-1]*CLIGHT+EXTERR_CLK*fabs(t[i]);
-	}
-	else {
-		data->errmsg="precise clock outage!";
-		return 0;
-	}
-	scvar=SQR(std);
-	return 1;
-}
-/* precise satellite position function -------------------------------------------- */
-int preciseph_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	double tt=1E-3;
-	int i;
-	/* signal time add 1E-3s */
-	obsd_t data_tt;
-	data_tt.sigtime=data->sigtime;
-	data_tt.sigtime.timeadd(tt);
-	data_tt.sat=data->sat;
-	
-
-	if (data->sat<=0||MAXSAT<data->sat) return 0;
-
-	/* satellite position and clock bias */
-	if (!precisepos(data,nav)||
-		!satclk(data,nav)) return 0;
-
-	if (!precisepos(&data_tt,nav)||
-		!satclk(&data_tt,nav)) return 0;
-
-	/* satellite velocity */
-	for (i=0; i<3; i++) {
-		data->posvel[i+3]=(data_tt.posvel[i]-data->posvel[i])/tt;
-	}
-	/* satellite antenna offset correction */
-	satantfunc->satantoff(data,nav);
-
-	/* relativistic effect correction and satellite clock drift */
-	if (data->dts[0]!=0.0) {
-		data->dts[0]=
-			data->dts[0]-2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
-		data->dts[1]=
-			(data_tt.dts[0]-data->dts[0])/tt;
-	}
-	else { /* no precise clock */
-		data->dts[0]=data->dts[1]=0.0;
-	}
-	data->svar=data->svar+scvar;
-
-	return 1;
-}
-
-/* qzss lex ephemeris ----------------------------------------------------------------------------- */
-/* Consturctors ------------------------------------------------------------------- */
-qzsslex_t::qzsslex_t(){
-}
-qzsslex_t::~qzsslex_t(){
-}
-/* Implementation functions ------------------------------------------------------- */
-/* base functions ----------------------------------------------------------------- */
-/* ura value ---------------------------------------------------------------------- */
-double qzsslex_t::vareph(int ura){
-	const double uraval[]={
-		0.08,0.11,0.15,0.21,0.30,0.43,0.60,0.85,1.20,1.70,2.40,3.40,4.85,6.85,
-		9.65,9.65
-	};
-	if (ura<0||15<ura) ura=15;
-	return uraval[ura];
-}
-/* qzss lex satellite clocks function --------------------------------------------- */
-int qzsslex_t::satclk(obsd_t *data,const nav_t *nav){
-	/* nav->lexeph[data->sat-1] */
-	int sat = data->sat;
-	double dt;
-
-	if (nav->lexeph[sat-1].sat!=sat || nav->lexeph[sat-1].toe.time==0){
-		data->errmsg="no lex ephemeris!";
-		return 0;
-	}
-	if ((dt=data->sigtime.timediff(nav->lexeph[sat-1].toe))>LEXEPHMAXAGE){
-		data->errmsg="lex ephemeris age error!";
-		return 0;
-	}
-#if 0
-	if (nav->lexeph[sat-1].health&0x18) {
-		data->errmsg="lex ephemeris unhealthy!";
-		return 0;
-	}
-#endif
-	data->dts[0]=nav->lexeph[sat-1].af0+nav->lexeph[sat-1].af1*dt;
-	data->dts[1]=nav->lexeph[sat-1].af1;
-
-	return 1;
-}
-/* qzss lex satellite position function ------------------------------------------- */
-int qzsslex_t::satpos(obsd_t *data,int iode,const nav_t *nav){
-	/* nav->lexeph[data->sat-1] */
-	int sat = data->sat;
-	double dt,t2,t3;
-
-	if (nav->lexeph[sat-1].sat!=sat || nav->lexeph[sat-1].toe.time==0){
-		data->errmsg="no lex ephemeris!";
-		return 0;
-	}
-	if ((dt=data->sigtime.timediff(nav->lexeph[sat-1].toe))>LEXEPHMAXAGE){
-		data->errmsg="lex ephemeris age error!";
-		return 0;
-	}
-#if 0
-	if (nav->lexeph[sat-1].health&0x18) {
-		data->errmsg="lex ephemeris unhealthy!";
-		return 0;
-	}
-#endif
-	/* satellite position */
-	t2=dt*dt/2.0; t3=t2*dt/3.0;
-	for (int i=0; i<3; i++) {
-		data->posvel[i]=nav->lexeph[sat-1].pos[i]+nav->lexeph[sat-1].vel[i]*dt +
-			nav->lexeph[sat-1].acc[i]*t2+nav->lexeph[sat-1].jerk[i]*t3;
-		data->posvel[i+3]=nav->lexeph[sat-1].vel[i] +
-			nav->lexeph[sat-1].acc[i]*dt+nav->lexeph[sat-1].jerk[i]*t2;
-	}
-
-	/* satellite clock */
-	data->dts[0]=nav->lexeph[sat-1].af0+nav->lexeph[sat-1].af1*dt;
-	data->dts[1]=nav->lexeph[sat-1].af1;
-
-	/* relativistic effect correction */
-	data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
-
-	data->svar=vareph(nav->lexeph[sat-1].ura);
-
-	return 1;
+#include "GNSS/EphModel/satellite.h"
+
+#include "BaseFunction/basefunction.h"
+
+/* constants and macros --------------------------------------------------------------------------- */
+/* for broadcast ephemeris */
+#define SQR(x)   ((x)*(x))
+#define RE_GLO   6378136.0        /* radius of earth (m)            ref [2] */
+#define MU_GPS   3.9860050E14     /* gravitational constant         ref [1] */
+#define MU_GLO   3.9860044E14     /* gravitational constant         ref [2] */
+#define MU_GAL   3.986004418E14   /* earth gravitational constant   ref [7] */
+#define MU_CMP   3.986004418E14   /* earth gravitational constant   ref [9] */
+#define J2_GLO   1.0826257E-3     /* 2nd zonal harmonic of geopot   ref [2] */
+#define OMGE_GLO 7.292115E-5      /* earth angular velocity (rad/s) ref [2] */
+#define OMGE_GAL 7.2921151467E-5  /* earth angular velocity (rad/s) ref [7] */
+#define OMGE_CMP 7.292115E-5      /* earth angular velocity (rad/s) ref [9] */
+#define SIN_5 -0.0871557427476582 /* sin(-5.0 deg) */
+#define COS_5  0.9961946980917456 /* cos(-5.0 deg) */
+#define ERREPH_GLO 5.0            /* error of glonass ephemeris (m) */
+#define TSTEP    60.0             /* integration step glonass ephemeris (s) */
+#define RTOL_KEPLER 1E-13         /* relative tolerance for Kepler equation */
+#define DEFURASSR 0.15            /* default accurary of ssr corr (m) */
+#define MAXECORSSR 10.0           /* max orbit correction of ssr (m) */
+#define MAXCCORSSR (1E-6*CLIGHT)  /* max clock correction of ssr (m) */
+#define MAXAGESSR 90.0            /* max age of ssr orbit and clock (s) */
+#define MAXAGESSR_HRCLK 10.0      /* max age of ssr high-rate clock (s) */
+#define STD_BRDCCLK 30.0          /* error of broadcast clock (m) */
+#define MAX_ITER_KEPLER 30        /* max number of iteration of Kelpler */
+/* for precise ephemeris */
+#define NMAX        10              /* order of polynomial interpolation */
+#define MAXDTE      900.0           /* max time difference to ephem time (s) */
+#define EXTERR_CLK  1E-3            /* extrapolation error for clock (m/s) */
+#define EXTERR_EPH  5E-7            /* extrapolation error for ephem (m/s^2) */
+/* for qzss lex ephemeris */
+#define LEXEPHMAXAGE    360.0           /* max age of lex ephemeris (s) */
+/* for satellite state cache */
+#define MAXDTSCACHE     1E-2            /* max transmission time difference of cache (s) */
+/* for batch kepler orbits */
+#define NKEPLER         6               /* fixed newton iterations of kepler equation */
+#define PIO2_1  1.57079632673412561417E+00 /* first 33 bits of pi/2 */
+#define PIO2_2  6.07710050630396597660E-11 /* second 33 bits of pi/2 */
+#define PIO2_3  2.02226624871116645580E-21 /* third 33 bits of pi/2 */
+#if defined(__GNUC__)&&!defined(__clang__)&&defined(__x86_64__)&&defined(__linux__)
+#define EPHKERNEL __attribute__((target_clones("avx512f","avx2","default")))
+#define EPHINLINE inline __attribute__((always_inline))
+#else
+#define EPHKERNEL
+#define EPHINLINE inline
+#endif
+
+static const double ura_eph[]={         /* ura values (ref [3] 20.3.3.3.1.1) */
+	2.4,3.4,4.85,6.85,9.65,13.65,24.0,48.0,96.0,192.0,384.0,768.0,1536.0,
+	3072.0,6144.0,0.0
+};
+static const double ura_nominal[]={     /* ura nominal values */
+	2.0,2.8,4.0,5.7,8.0,11.3,16.0,32.0,64.0,128.0,256.0,512.0,1024.0,
+	2048.0,4096.0,8192.0
+};
+
+/* per-epoch satellite state cache ---------------------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+satcache_t::satcache_t(){
+	initlock(&lock);
+	clear();
+}
+satcache_t::~satcache_t(){
+}
+/* Implementation functions ------------------------------------------------------- */
+/* clear all satellite states ----------------------------------------------------- */
+void satcache_t::clear(){
+	for (int i=0; i<MAXSAT; i++) {
+		time[i]=gtime_t(); key[i]=-1;
+	}
+	nhit=nmiss=0;
+}
+/* get satellite state at transmission time of observation ------------------------
+* position by 2nd order extrapolation with acceleration in ecef (central gravity,
+* centrifugal and coriolis terms), truncation error <1E-6 m within MAXDTSCACHE
+* -------------------------------------------------------------------------------- */
+int satcache_t::get(obsd_t *data,int key){
+	double dt,rs[6],dtss[2],var,a[3],r3;
+	int i=data->sat-1,h;
+
+	if (data->sat<=0||data->sat>MAXSAT) return 0;
+
+	tolock(&lock);
+	if (time[i].time==0||this->key[i]!=key||
+		fabs(dt=data->sigtime.timediff(time[i]))>MAXDTSCACHE) {
+		nmiss++;
+		tounlock(&lock);
+		return 0;
+	}
+	for (int j=0; j<6; j++) rs[j]=posvel[i][j];
+	dtss[0]=dts[i][0]; dtss[1]=dts[i][1]; var=svar[i]; h=svh[i];
+	nhit++;
+	tounlock(&lock);
+
+	r3=pow(dot(rs,rs,3),1.5);
+	if (r3<=0.0) return 0;
+	a[0]=-MU_GPS*rs[0]/r3+OMGE*OMGE*rs[0]+2.0*OMGE*rs[4];
+	a[1]=-MU_GPS*rs[1]/r3+OMGE*OMGE*rs[1]-2.0*OMGE*rs[3];
+	a[2]=-MU_GPS*rs[2]/r3;
+	for (int j=0; j<3; j++) {
+		data->posvel[j]=rs[j]+rs[j+3]*dt+0.5*a[j]*dt*dt;
+		data->posvel[j+3]=rs[j+3]+a[j]*dt;
+	}
+	data->dts[0]=dtss[0]+dtss[1]*dt;
+	data->dts[1]=dtss[1];
+	data->svar=var;
+	data->svh=h;
+	return 1;
+}
+/* set satellite state of observation --------------------------------------------- */
+void satcache_t::set(const obsd_t *data,int key){
+	int i=data->sat-1;
+
+	if (data->sat<=0||data->sat>MAXSAT) return;
+
+	tolock(&lock);
+	time[i]=data->sigtime;
+	this->key[i]=key;
+	for (int j=0; j<6; j++) posvel[i][j]=data->posvel[j];
+	dts[i][0]=data->dts[0]; dts[i][1]=data->dts[1];
+	svar[i]=data->svar;
+	svh[i]=data->svh;
+	tounlock(&lock);
+}
+
+/* broadcast ephemerides of epoch ---------------------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+ephbatch_t::ephbatch_t(){
+	n=0;
+}
+ephbatch_t::~ephbatch_t(){
+}
+/* Implementation functions ------------------------------------------------------- */
+/* clear entries (capacity is kept) ----------------------------------------------- */
+void ephbatch_t::clear(){
+	n=0;
+	eph.clear(); ref.clear();
+}
+/* add ephemeris at transmission time --------------------------------------------- */
+int ephbatch_t::add(const eph_t &eph,gtime_t time,int ref){
+	ephblk_t *b;
+	double mu;
+	int sys,prn,j=n%NEPHLANE;
+
+	if (j==0) {
+		if ((int)blk.size()<=n/NEPHLANE) blk.resize(n/NEPHLANE+1);
+		memset(&blk[n/NEPHLANE],0,sizeof(ephblk_t));
+	}
+	b=&blk[n/NEPHLANE];
+	this->eph.push_back(&eph); this->ref.push_back(ref);
+
+	b->tk[j]=time.timediff(eph.toe); b->tc[j]=time.timediff(eph.toc);
+	b->A[j]=eph.A; b->e[j]=eph.e; b->M0[j]=eph.M0; b->omg[j]=eph.omg;
+	b->i0[j]=eph.i0; b->idot[j]=eph.idot; b->OMG0[j]=eph.OMG0; b->OMGd[j]=eph.OMGd;
+	b->toes[j]=eph.toes;
+	b->cus[j]=eph.cus; b->cuc[j]=eph.cuc; b->crs[j]=eph.crs;
+	b->crc[j]=eph.crc; b->cis[j]=eph.cis; b->cic[j]=eph.cic;
+	b->f0[j]=eph.f0; b->f1[j]=eph.f1; b->f2[j]=eph.f2;
+
+	switch ((sys=satsys(eph.sat,&prn))) {
+	case SYS_GAL: mu=MU_GAL; b->omge[j]=OMGE_GAL; break;
+	case SYS_CMP: mu=MU_CMP; b->omge[j]=OMGE_CMP; break;
+	default:      mu=MU_GPS; b->omge[j]=OMGE;     break;
+	}
+	b->geo[j]=sys==SYS_CMP&&prn<=5 ? 1.0 : 0.0;
+
+	/* constants of ephemeris (no sqrt in batch loops) */
+	b->n0[j]=sqrt(mu/(eph.A*eph.A*eph.A))+eph.deln;
+	b->sqe[j]=sqrt(1.0-eph.e*eph.e);
+	b->frel[j]=-2.0*sqrt(mu*eph.A)*eph.e/SQR(CLIGHT);
+	return n++;
+}
+/* round to nearest integer without branch or libm call (|x|<2^51) ---------------- */
+static EPHINLINE double rintb(double x){
+	const double R=6755399441055744.0; /* 2^52+2^51 */
+	return (x+R)-R;
+}
+/* sine and cosine without branch (vectorized in loops) ----------------------------
+* reduction by 3-part pi/2 and fdlibm kernel polynomials on [-pi/4,pi/4],
+* error <2 ulp for |x|<1E5
+* -------------------------------------------------------------------------------- */
+static EPHINLINE void sincosb(double x,double *s,double *c){
+	const double S1=-1.66666666666666324348E-01,S2= 8.33333333332248946124E-03,
+		S3=-1.98412698298579493134E-04,S4= 2.75573137070700676789E-06,
+		S5=-2.50507602534068634195E-08,S6= 1.58969099521155010221E-10;
+	const double C1= 4.16666666666666019037E-02,C2=-1.38888888888741095749E-03,
+		C3= 2.48015872894767294178E-05,C4=-2.75573143513906633035E-07,
+		C5= 2.08757232129817482790E-09,C6=-1.13596475577881948265E-11;
+	double k=rintb(x*0.636619772367581343076),y,z,sy,cy,q,h,odd;
+
+	y=((x-k*PIO2_1)-k*PIO2_2)-k*PIO2_3;
+	z=y*y;
+	sy=y+y*z*(S1+z*(S2+z*(S3+z*(S4+z*(S5+z*S6)))));
+	cy=1.0-(0.5*z-z*z*(C1+z*(C2+z*(C3+z*(C4+z*(C5+z*C6))))));
+	q=k-4.0*rintb(k*0.25-0.375);		/* quadrant 0-3 */
+	h=rintb(q*0.5-0.25);				/* 1: quadrant 2,3 */
+	odd=q-2.0*h;						/* 1: quadrant 1,3 (swap sin and cos) */
+	*s=(1.0-2.0*h)*(sy+odd*(cy-sy));
+	*c=(1.0-2.0*(odd+h-2.0*odd*h))*(cy+odd*(sy-cy));
+}
+/* kepler orbits and clocks of blocks -------------------------------------------
+* true anomaly and argument of latitude by sine/cosine instead of atan2, short
+* series of harmonic correction angle (<1E-4 rad), geo rotation blended by flag
+* -------------------------------------------------------------------------------- */
+EPHKERNEL static void kepler_batch(ephblk_t *blk,int nblk){
+	double sinE,cosE,den,sv,cv,sw,cw,su,cu,sin2u,cos2u,du,sdu,cdu,r,inc,si,ci,O,sO,cO;
+	double x,y,xg,yg,zg,so,co,M,E;
+	int j,k;
+
+	for (ephblk_t *b=blk; b<blk+nblk; b++) for (j=0; j<NEPHLANE; j++) {
+
+		/* mean anomaly and kepler equation by fixed newton iterations */
+		M=E=b->M0[j]+b->n0[j]*b->tk[j];
+#pragma GCC unroll 8
+		for (k=0; k<NKEPLER; k++) {
+			sincosb(E,&sinE,&cosE);
+			E-=(E-b->e[j]*sinE-M)/(1.0-b->e[j]*cosE);
+		}
+		sincosb(E,&sinE,&cosE);
+		den=1.0-b->e[j]*cosE;
+
+		/* argument of latitude u=nu+omg */
+		sv=b->sqe[j]*sinE/den; cv=(cosE-b->e[j])/den;
+		sincosb(b->omg[j],&sw,&cw);
+		su=sv*cw+cv*sw; cu=cv*cw-sv*sw;
+		sin2u=2.0*su*cu; cos2u=(cu-su)*(cu+su);
+		du=b->cus[j]*sin2u+b->cuc[j]*cos2u;
+		r=b->A[j]*den+b->crs[j]*sin2u+b->crc[j]*cos2u;
+		inc=b->i0[j]+b->idot[j]*b->tk[j]+b->cis[j]*sin2u+b->cic[j]*cos2u;
+		sdu=du*(1.0-du*du/6.0*(1.0-du*du/20.0));
+		cdu=1.0-du*du/2.0*(1.0-du*du/12.0);
+		x=r*(cu*cdu-su*sdu); y=r*(su*cdu+cu*sdu);
+		sincosb(inc,&si,&ci);
+
+		/* geo: inertial node and rotation by omge*tk, -5 deg */
+		O=b->OMG0[j]+(b->OMGd[j]-b->omge[j]*(1.0-b->geo[j]))*b->tk[j]-b->omge[j]*b->toes[j];
+		sincosb(O,&sO,&cO);
+		xg=x*cO-y*ci*sO;
+		yg=x*sO+y*ci*cO;
+		zg=y*si;
+		sincosb(b->omge[j]*b->tk[j]*b->geo[j],&so,&co);
+		b->x[j]=xg+b->geo[j]*( xg*co+yg*so*COS_5+zg*so*SIN_5-xg);
+		b->y[j]=yg+b->geo[j]*(-xg*so+yg*co*COS_5+zg*co*SIN_5-yg);
+		b->z[j]=zg+b->geo[j]*(-yg*SIN_5+zg*COS_5-zg);
+
+		/* clock with relativity correction */
+		b->dts[j]=b->f0[j]+b->f1[j]*b->tc[j]+b->f2[j]*b->tc[j]*b->tc[j]+b->frel[j]*sinE;
+	}
+}
+/* positions and clocks of all entries -------------------------------------------- */
+void ephbatch_t::eph2pos(){
+	if (n>0) kepler_batch(&blk[0],(n+NEPHLANE-1)/NEPHLANE);
+}
+
+/* satellite functions ---------------------------------------------------------------------------- */
+/* parent class of satellite functions ------------------------------------------------------------ */
+/* Constructors ------------------------------------------------------------------- */
+satellite_t::satellite_t(){
+	satantfunc=NULL;
+	cache=NULL;
+	iode=-1;
+}
+satellite_t::~satellite_t(){
+	satantfunc=NULL;
+}
+/* Implementation functions ------------------------------------------------------- */
+int satellite_t::satclk(obsd_t *data,const nav_t *nav){
+	return 0;
+}
+int satellite_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	return 0;
+}
+/* compute satellite positions and clocks ----------------------------------------- */
+int satellite_t::satposclk(obs_t *obs,const nav_t *nav){
+	int num=0;
+
+	for (int i=0;i<obs->n&&i<MAXOBS;i++){
+		/* reset satellite data of observation */
+		obs->data[i].satreset();
+
+		/* search any psuedorange */
+		if (obs->data[i].sigtime_opsr()!=1) continue;
+
+		/* satellite clock bias to correct signal time */
+		iode=-1;
+		if (!satclk(&obs->data[i],nav)) {
+			obs->data[i].errmsg = "no satellite clock bias!";
+			continue;
+		}
+		obs->data[i].sigtime_sclk();
+
+		/* state of same satellite and ephemeris computed for other receiver */
+		if (cache&&cache->get(&obs->data[i],iode)) {
+			if (obs->data[i].svh!=-1) num++;
+			continue;
+		}
+		if (!satpos(&obs->data[i],999,nav)){
+			obs->data[i].errmsg = "no ephemeris!";
+			continue;
+		}
+		if (cache) cache->set(&obs->data[i],iode);
+		if (obs->data[i].svh!=-1) num++;
+	}
+	/* end */
+	return num;
+}
+
+/* subclass of satellite functions ---------------------------------------------------------------- */
+/* broadcast ephemeris ---------------------------------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+broadcast_t::broadcast_t(){
+	batch=1;
+	for (int i=0; i<MAXSAT; i++) glost[i].toe.time=0;
+}
+broadcast_t::~broadcast_t(){
+}
+/* Implementation functions ------------------------------------------------------- */
+/* broadcast functions ------------------------------------------------------------ */
+
+/* variance by ura ephemeris (ref [1] 20.3.3.3.1.1) ------------------------------- */
+double broadcast_t::var_uraeph(int ura)
+{
+	return ura<0||15<ura ? SQR(8192.0) : SQR(ura_nominal[ura]);
+}
+/* variance by ura ssr (ref [4]) -------------------------------------------------- */
+double broadcast_t::var_urassr(int ura)
+{
+	double std;
+	if (ura<= 0) return SQR(DEFURASSR);
+	if (ura>=63) return SQR(5.4665);
+	std=(pow(3.0,(ura>>3)&7)*(1.0+(ura&7)/4.0)-1.0)*1E-3;
+	return SQR(std);
+}
+/* glonass orbit differential equations ------------------------------------------- */
+void broadcast_t::deq(const double *x,double *xdot,const double *acc)
+{
+	double a,b,c,r2=dot(x,x,3),r3=r2*sqrt(r2),omg2=SQR(OMGE_GLO);
+
+	if (r2<=0.0) {
+		xdot[0]=xdot[1]=xdot[2]=xdot[3]=xdot[4]=xdot[5]=0.0;
+		return;
+	}
+	/* ref [2] A.3.1.2 with bug fix for xdot[4],xdot[5] */
+	a=1.5*J2_GLO*MU_GLO*SQR(RE_GLO)/r2/r3; /* 3/2*J2*mu*Ae^2/r^5 */
+	b=5.0*x[2]*x[2]/r2;                    /* 5*z^2/r^2 */
+	c=-MU_GLO/r3-a*(1.0-b);                /* -mu/r^3-a(1-b) */
+	xdot[0]=x[3]; xdot[1]=x[4]; xdot[2]=x[5];
+	xdot[3]=(c+omg2)*x[0]+2.0*OMGE_GLO*x[4]+acc[0];
+	xdot[4]=(c+omg2)*x[1]-2.0*OMGE_GLO*x[3]+acc[1];
+	xdot[5]=(c-2.0*a)*x[2]+acc[2];
+}
+/* glonass position and velocity by numerical integration ------------------------- */
+void broadcast_t::glorbit(double t,double *x,const double *acc)
+{
+	double k1[6],k2[6],k3[6],k4[6],w[6];
+	int i;
+
+	deq(x,k1,acc); for (i=0; i<6; i++) w[i]=x[i]+k1[i]*t/2.0;
+	deq(w,k2,acc); for (i=0; i<6; i++) w[i]=x[i]+k2[i]*t/2.0;
+	deq(w,k3,acc); for (i=0; i<6; i++) w[i]=x[i]+k3[i]*t;
+	deq(w,k4,acc);
+	for (i=0; i<6; i++) x[i]+=(k1[i]+2.0*k2[i]+2.0*k3[i]+k4[i])*t/6.0;
+}
+/* integrated glonass state at grid point before time from toe --------------------
+* continue from last state of the same ephemeris if it is on the way from toe to t,
+* otherwise integrate from toe. steps are the same as integration from toe at once
+* return : time from toe of state (s)
+* -------------------------------------------------------------------------------- */
+double broadcast_t::glostate(int sat,const geph_t &geph,double t,double *x){
+	glostate_t *s=sat>0&&sat<=MAXSAT ? glost+sat-1 : NULL;
+	double tg=0.0,tt=t<0.0 ? -TSTEP : TSTEP;
+	int i;
+
+	if (s&&s->toe.time==geph.toe.time&&s->toe.sec==geph.toe.sec&&s->iode==geph.iode&&
+		s->pos0[0]==geph.pos[0]&&s->pos0[1]==geph.pos[1]&&s->pos0[2]==geph.pos[2]&&
+		s->tg*t>=0.0&&fabs(s->tg)<=fabs(t)) {
+		tg=s->tg;
+		for (i=0; i<6; i++) x[i]=s->x[i];
+	}
+	else {
+		for (i=0; i<3; i++) {
+			x[i]=geph.pos[i];
+			x[i+3]=geph.vel[i];
+		}
+	}
+	for (; fabs(t-tg)>=TSTEP; tg+=tt) glorbit(tt,x,geph.acc);
+
+	if (!s) return tg;
+	s->toe=geph.toe; s->iode=geph.iode;
+	for (i=0; i<3; i++) s->pos0[i]=geph.pos[i];
+	s->tg=tg;
+	for (i=0; i<6; i++) s->x[i]=x[i];
+	return tg;
+}
+/* first entry of satellite ephemeris index with toe>=time-tmax (binary search) -- */
+template <typename T>
+static int lowertoe(const vector<int> &idx,const vector<T> &eph,gtime_t T::*toe,
+	const gtime_t &time,double tmax){
+	int lo=0,hi=(int)idx.size(),mid;
+
+	while (lo<hi) {
+		mid=(lo+hi)/2;
+		if ((eph[idx[mid]].*toe).timediff(time)<-tmax) lo=mid+1; else hi=mid;
+	}
+	return lo;
+}
+/* select GPS/GAL/QZS/CMP ephemeris -----------------------------------------------
+* toe closest to time (last entry if same distance) or first entry of iode,
+* by per-satellite index of nav if indexed, otherwise by search of all entries
+* -------------------------------------------------------------------------------- */
+int broadcast_t::seleph(obsd_t *data,int iode,const nav_t *nav){
+	double t,tmax,tmin;
+	int i,k,neph=-1;
+
+	switch (satsys(data->sat,NULL)){
+		case SYS_QZS: tmax=MAXDTOE_QZS+1.0; break;
+		case SYS_GAL: tmax=MAXDTOE_GAL+1.0; break;
+		case SYS_CMP: tmax=MAXDTOE_CMP+1.0; break;
+		default: tmax=MAXDTOE+1.0; break;
+		}
+	tmin=tmax+1.0;
+
+	if (nav->nidx>0&&data->sat>0&&data->sat<=MAXSAT) {
+		const vector<int> &idx=nav->ephidx[data->sat-1];
+		for (k=lowertoe(idx,nav->eph,&eph_t::toe,data->time,tmax); k<(int)idx.size(); k++) {
+			i=idx[k];
+			if ((t=nav->eph[i].toe.timediff(data->time))>tmax) break;
+			if (iode>=0) {
+				if (nav->eph[i].iode==iode&&(neph<0||i<neph)) neph=i;
+				continue;
+			}
+			if ((t=fabs(t))<tmin||(t==tmin&&i>neph)) { neph=i; tmin=t; }
+		}
+		if (neph<0) { 
+			data->errmsg="no broadcast ephemeris!";
+			return -1;
+		}
+		return neph;
+	}
+	for (i=0; i<nav->n; i++) {
+		if (nav->eph[i].sat!=data->sat) continue;
+		if (iode>=0&&nav->eph[i].iode!=iode) continue;
+		if ((t=fabs(nav->eph[i].toe.timediff(data->time)))>tmax) continue;
+		if (iode>=0) return i;
+		if (t<=tmin) { neph=i; tmin=t; } /* toe closest to time */
+	}
+	if (iode>=0||neph<0) { 
+		data->errmsg="no broadcast ephemeris!";
+		return -1;
+	}
+	return neph;
+}
+/* select GLO ephemeris ----------------------------------------------------------- */
+int broadcast_t::selgeph(obsd_t *data, int iode, const nav_t *nav){
+	double t,tmax=MAXDTOE_GLO,tmin=tmax+1.0;
+	int i,k,ngeph=-1;
+
+	if (nav->nidx>0&&data->sat>0&&data->sat<=MAXSAT) {
+		const vector<int> &idx=nav->ephidx[data->sat-1];
+		for (k=lowertoe(idx,nav->geph,&geph_t::toe,data->time,tmax); k<(int)idx.size(); k++) {
+			i=idx[k];
+			if ((t=nav->geph[i].toe.timediff(data->time))>tmax) break;
+			if (iode>=0) {
+				if (nav->geph[i].iode==iode&&(ngeph<0||i<ngeph)) ngeph=i;
+				continue;
+			}
+			if ((t=fabs(t))<tmin||(t==tmin&&i>ngeph)) { ngeph=i; tmin=t; }
+		}
+		if (ngeph<0) {
+			data->errmsg="no glonass broadcast ephemeris!";
+			return -1;
+		}
+		return ngeph;
+	}
+	for (i=0; i<nav->ng; i++) {
+		if (nav->geph[i].sat!=data->sat) continue;
+		if (iode>=0&&nav->geph[i].iode!=iode) continue;
+		if ((t=fabs(nav->geph[i].toe.timediff(data->time)))>tmax) continue;
+		if (iode>=0) return i;
+		if (t<=tmin) { ngeph=i; tmin=t; } /* toe closest to time */
+	}
+	if (iode>=0||ngeph<0) {
+		data->errmsg="no glonass broadcast ephemeris!";
+		return -1;
+	}
+	return ngeph;
+}
+/* select SBS ephemeris ----------------------------------------------------------- */
+int broadcast_t::selseph(obsd_t *data,const nav_t *nav){
+	double t,tmax=MAXDTOE_SBS,tmin=tmax+1.0;
+	int i,k,nseph=-1;
+
+	if (nav->nidx>0&&data->sat>0&&data->sat<=MAXSAT) {
+		const vector<int> &idx=nav->ephidx[data->sat-1];
+		for (k=lowertoe(idx,nav->seph,&seph_t::t0,data->time,tmax); k<(int)idx.size(); k++) {
+			i=idx[k];
+			if ((t=nav->seph[i].t0.timediff(data->time))>tmax) break;
+			if ((t=fabs(t))<tmin||(t==tmin&&i>nseph)) { nseph=i; tmin=t; }
+		}
+	}
+	else for (i=0; i<nav->ns; i++) {
+		if (nav->seph[i].sat!=data->sat) continue;
+		if ((t=fabs(nav->seph[i].t0.timediff(data->time)))>tmax) continue;
+		if (t<=tmin) { nseph=i; tmin=t; } /* toe closest to time */
+	}
+	if (nseph<0) {
+		data->errmsg="no SBS broadcast ephemeris!";
+		return -1;
+	}
+	return nseph;
+}
+/* position functions ------------------------------------------------------------- */
+/* position from GPS/GAL/QZS/CMP ephemeris ---------------------------------------- */
+void broadcast_t::eph2pos(obsd_t *data,const eph_t &eph){
+	double tk,M,E,Ek,sinE,cosE,u,r,i,O,sin2u,cos2u,x,y,sinO,cosO,cosi,mu,omge;
+	double xg,yg,zg,sino,coso;
+	int n,sys,prn;
+
+	if (eph.A<=0.0) {
+		data->satreset();
+		return;
+	}
+	tk=data->sigtime.timediff(eph.toe);
+
+	switch ((sys=satsys(eph.sat,&prn))) {
+	case SYS_GAL: mu=MU_GAL; omge=OMGE_GAL; break;
+	case SYS_CMP: mu=MU_CMP; omge=OMGE_CMP; break;
+	default:      mu=MU_GPS; omge=OMGE;     break;
+	}
+	M=eph.M0+(sqrt(mu/(eph.A*eph.A*eph.A))+eph.deln)*tk;
+
+	for (n=0,E=M,Ek=0.0; fabs(E-Ek)>RTOL_KEPLER&&n<MAX_ITER_KEPLER; n++) {
+		Ek=E; E-=(E-eph.e*sin(E)-M)/(1.0-eph.e*cos(E));
+	}
+	if (n>=MAX_ITER_KEPLER) {
+		return;
+	}
+	sinE=sin(E); cosE=cos(E);
+
+	u=atan2(sqrt(1.0-eph.e*eph.e)*sinE,cosE-eph.e)+eph.omg;
+	r=eph.A*(1.0-eph.e*cosE);
+	i=eph.i0+eph.idot*tk;
+	sin2u=sin(2.0*u); cos2u=cos(2.0*u);
+	u+=eph.cus*sin2u+eph.cuc*cos2u;
+	r+=eph.crs*sin2u+eph.crc*cos2u;
+	i+=eph.cis*sin2u+eph.cic*cos2u;
+	x=r*cos(u); y=r*sin(u); cosi=cos(i);
+
+	/* beidou geo satellite (ref [9]) */
+	if (sys==SYS_CMP&&prn<=5) {
+		O=eph.OMG0+eph.OMGd*tk-omge*eph.toes;
+		sinO=sin(O); cosO=cos(O);
+		xg=x*cosO-y*cosi*sinO;
+		yg=x*sinO+y*cosi*cosO;
+		zg=y*sin(i);
+		sino=sin(omge*tk); coso=cos(omge*tk);
+		data->posvel[0]= xg*coso+yg*sino*COS_5+zg*sino*SIN_5;
+		data->posvel[1]=-xg*sino+yg*coso*COS_5+zg*coso*SIN_5;
+		data->posvel[2]=-yg*SIN_5+zg*COS_5;
+	}
+	else {
+		O=eph.OMG0+(eph.OMGd-omge)*tk-omge*eph.toes;
+		sinO=sin(O); cosO=cos(O);
+		data->posvel[0]=x*cosO-y*cosi*sinO;
+		data->posvel[1]=x*sinO+y*cosi*cosO;
+		data->posvel[2]=y*sin(i);
+	}
+	tk=data->sigtime.timediff(eph.toc);
+	data->dts[0]=eph.f0+eph.f1*tk+eph.f2*tk*tk;
+
+	/* relativity correction */
+	data->dts[0]-=2.0*sqrt(mu*eph.A)*eph.e*sinE/SQR(CLIGHT);
+
+	/* position and clock error variance */
+	data->svar=var_uraeph(eph.sva);
+}
+/* position and velocity from GLO ephemeris -------------------------------------- */
+void broadcast_t::geph2pos(obsd_t *data,const geph_t &geph){
+	double t,tg,x[6];
+	int i;
+
+	t=data->sigtime.timediff(geph.toe);
+
+	data->dts[0]=-geph.taun+geph.gamn*t;
+
+	/* last step from integrated state on TSTEP grid */
+	tg=glostate(data->sat,geph,t,x);
+	if (fabs(t-tg)>1E-9) glorbit(t-tg,x,geph.acc);
+
+	for (i=0; i<6; i++) data->posvel[i]=x[i];
+
+	data->svar=SQR(ERREPH_GLO);
+}
+/* position bias from SBS ephemeris ----------------------------------------------- */
+void broadcast_t::seph2pos(obsd_t *data,const seph_t &seph){
+	double t;
+	int i;
+
+	t=data->sigtime.timediff(seph.t0);
+
+	for (i=0; i<3; i++) {
+		data->posvel[i]=seph.pos[i]+seph.vel[i]*t+seph.acc[i]*t*t/2.0;
+	}
+	data->dts[0]=seph.af0+seph.af1*t;
+
+	data->svar=var_uraeph(seph.sva);
+}
+/* clock functions ---------------------------------------------------------------- */
+/* clock bias from GPS/GAL/QZS/CMP ephemeris -------------------------------------- */
+void broadcast_t::eph2clk(obsd_t *data,const eph_t &eph){
+	double t;
+
+	t=data->sigtime.timediff(eph.toc);
+
+	for (int i=0; i<2; i++) {
+		t-=eph.f0+eph.f1*t+eph.f2*t*t;
+	}
+	data->dts[0]=eph.f0+eph.f1*t+eph.f2*t*t;
+}
+/* clock bias from GLO ephemeris -------------------------------------------------- */
+void broadcast_t::geph2clk(obsd_t *data,const geph_t &geph){
+	double t;
+
+	t=data->sigtime.timediff(geph.toe);
+
+	for (int i=0; i<2; i++) {
+		t-=-geph.taun+geph.gamn*t;
+	}
+	data->dts[0]=-geph.taun+geph.gamn*t;
+}
+/* clock bias from SBS ephemeris -------------------------------------------------- */
+void broadcast_t::seph2clk(obsd_t *data,const seph_t &seph){
+	double t;
+
+	t=data->sigtime.timediff(seph.t0);
+
+	for (int i=0; i<2; i++) {
+		t-=seph.af0+seph.af1*t;
+	}
+	data->dts[0]=seph.af0+seph.af1*t;
+}
+/* broadcast satellite position function ------------------------------------------ */
+int broadcast_t::broadpos(obsd_t *data,int iode,const nav_t *nav){
+	obsd_t d1E_3;
+	/* satellite system */
+	int sys=satsys(data->sat,NULL);
+	data->svh=-1;
+
+	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP){
+		int neph=seleph(data,iode,nav);
+		if (neph>=0) eph2pos(data,nav->eph[neph]);
+		else return 0;
+		d1E_3.sigtime=data->sigtime; d1E_3.sigtime.timeadd(1E-3);
+		eph2pos(&d1E_3,nav->eph[neph]);
+		if (data->svar<129.0) data->svh = nav->eph[neph].svh;
+	}
+	else if (sys==SYS_GLO){
+		int ngeph=selgeph(data,iode,nav);
+		if (ngeph>=0) geph2pos(data,nav->geph[ngeph]);
+		else return 0;
+		data->svh=nav->geph[ngeph].svh;
+
+		/* velocity of integrated orbit and clock drift (no differential approx) */
+		data->dts[1]=nav->geph[ngeph].gamn;
+		return 1;
+	}
+	else if (sys==SYS_SBS){
+		int nseph=selseph(data,nav);
+		if (nseph>=0) seph2pos(data,nav->seph[nseph]);
+		else return 0;
+		d1E_3.sigtime=data->sigtime; d1E_3.sigtime.timeadd(1E-3);
+		seph2pos(&d1E_3,nav->seph[nseph]);
+		if (data->svar<129.0) data->svh=nav->seph[nseph].svh;
+	}
+	else return 0;
+
+	/* satellite velocity and clock drift by differential approx */
+	for (int i=0; i<3; i++) data->posvel[i+3]=(d1E_3.posvel[i]-data->posvel[i])/1E-3;
+	data->dts[1]=(d1E_3.dts[0]-data->dts[0])/1E-3;
+
+	/* no satellite antenna offset correction becasue broadcast navigation ephemeris
+	 * refer to the antenna phase center of satellite */
+
+	return 1;
+}
+/* broadcast satellite clocks function -------------------------------------------- */
+int broadcast_t::satclk(obsd_t *data,const nav_t *nav){
+	/* satellite system */
+	int sys=satsys(data->sat,NULL);
+	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP){
+		int neph = seleph(data,-1,nav);
+		if (neph>=0) eph2clk(data,nav->eph[neph]);
+		else return 0;
+		iode=nav->eph[neph].iode;
+	}
+	else if (sys==SYS_GLO){
+		int ngeph = selgeph(data,-1,nav);
+		if (ngeph>=0) geph2clk(data,nav->geph[ngeph]);
+		else return 0;
+		iode=nav->geph[ngeph].iode;
+	}
+	else if (sys==SYS_SBS){
+		int nseph = selseph(data,nav);
+		if (nseph>=0) seph2clk(data,nav->seph[nseph]);
+		else return 0;
+		iode=(int)(nav->seph[nseph].t0.time%86400);
+	}
+	else return 0;
+	
+	return 1;
+}
+/* broadcast satellite position function called by satposclk() ------------ */
+int broadcast_t::satpos(obsd_t *data,int flag,const nav_t *nav){
+	data->svh=0;
+	return broadpos(data,-1,nav);
+}
+/* compute satellite positions and clocks (kepler orbits in batch) ----------------
+* GPS/GAL/QZS/CMP satellites of epoch are added to batch at transmission time and
+* +1ms (velocity and clock drift by differential approx as broadpos()), other
+* systems are computed by satpos()
+* -------------------------------------------------------------------------------- */
+int broadcast_t::satposclk(obs_t *obs,const nav_t *nav){
+	obsd_t *data;
+	const ephblk_t *b;
+	gtime_t t1;
+	int i,j,k,sys,neph,num=0;
+
+	if (!batch) return satellite_t::satposclk(obs,nav);
+
+	ephb.clear();
+	for (i=0; i<obs->n&&i<MAXOBS; i++) {
+		data=&obs->data[i];
+		data->satreset();
+
+		/* search any psuedorange */
+		if (data->sigtime_opsr()!=1) continue;
+
+		/* satellite clock bias to correct signal time */
+		iode=-1;
+		if (!satclk(data,nav)) {
+			data->errmsg = "no satellite clock bias!";
+			continue;
+		}
+		data->sigtime_sclk();
+
+		/* state of same satellite and ephemeris computed for other receiver */
+		if (cache&&cache->get(data,iode)) {
+			if (data->svh!=-1) num++;
+			continue;
+		}
+		sys=satsys(data->sat,NULL);
+		if ((sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP)&&
+			(neph=seleph(data,-1,nav))>=0&&nav->eph[neph].A>0.0) {
+			t1=data->sigtime; t1.timeadd(1E-3);
+			ephb.add(nav->eph[neph],data->sigtime,i);
+			ephb.add(nav->eph[neph],t1,i);
+			continue;
+		}
+		data->svh=0;
+		if (!broadpos(data,-1,nav)){
+			data->errmsg = "no ephemeris!";
+			continue;
+		}
+		if (cache) cache->set(data,iode);
+		if (data->svh!=-1) num++;
+	}
+	/* kepler orbits of epoch */
+	ephb.eph2pos();
+
+	for (k=0; k+1<ephb.n; k+=2) {
+		data=&obs->data[ephb.ref[k]];
+		b=&ephb.blk[k/NEPHLANE]; j=k%NEPHLANE; /* entry k+1 in same block */
+		data->posvel[0]=b->x[j]; data->posvel[1]=b->y[j]; data->posvel[2]=b->z[j];
+		data->posvel[3]=(b->x[j+1]-b->x[j])/1E-3;
+		data->posvel[4]=(b->y[j+1]-b->y[j])/1E-3;
+		data->posvel[5]=(b->z[j+1]-b->z[j])/1E-3;
+		data->dts[0]=b->dts[j];
+		data->dts[1]=(b->dts[j+1]-b->dts[j])/1E-3;
+		data->svar=var_uraeph(ephb.eph[k]->sva);
+		data->svh=data->svar<129.0 ? ephb.eph[k]->svh : -1;
+
+		if (cache) cache->set(data,ephb.eph[k]->iode);
+		if (data->svh!=-1) num++;
+	}
+	return num;
+}
+
+
+/* broadcast ephemeris with sbas correction ------------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+broadsbas_t::broadsbas_t(){
+	batch=0; /* corrections in satpos() */
+}
+broadsbas_t::~broadsbas_t(){
+}
+/* Implementation functions -------------------------------------------------------- */
+/* broadcast satellite position function with sbas correction ---------------------- */
+int broadsbas_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	int nsbas;
+	/* search sbas satellite correciton */
+	for (nsbas=0; nsbas<nav->sbssat.nsat; nsbas++) 
+		if (nav->sbssat.sat[nsbas].sat==data->sat) break;
+	if (nsbas>=nav->sbssat.nsat){
+		broadpos(data,-1,nav);
+		data->svh=-1;
+		return 0;
+	}
+	/* satellite postion and clock from broadcast ephemeris */
+	if (!broadpos(data,nav->sbssat.sat[nsbas].lcorr.iode,nav)) return 0;
+	if (nav->sbssat.sbssatcorr(data)) return 1;
+	data->svh=-1;
+	return 0;
+}
+
+/* broadcast ephemeris with ssr_apc correction ---------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+broadssrapc_t::broadssrapc_t(){
+	batch=0; /* corrections in satpos() */
+}
+broadssrapc_t::~broadssrapc_t(){
+}
+/* base functions ----------------------------------------------------------------- */
+/* broadcast satellite position function with ssr_apc correction ------------------ */
+int broadssrapc_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	/* pointer to the ssr_t in nav */
+	const ssr_t *ssr=nav->ssr+data->sat-1;
+	/* satellite system */
+	int sys=satsys(data->sat,NULL);
+	int neph=-1;
+	double t1,t2,t3,deph[3],dclk,dant[3]={ 0 },tk;
+	vec3_t er,ea,ec;
+
+
+	if (!ssr->t0[0].time) {
+		return 0;
+	}
+	if (!ssr->t0[1].time) {
+		return 0;
+	}
+	/* inconsistency between orbit and clock correction */
+	if (ssr->iod[0]!=ssr->iod[1]) {
+		data->svh=-1;
+		return 0;
+	}
+	t1=data->sigtime.timediff(ssr->t0[0]);
+	t2=data->sigtime.timediff(ssr->t0[1]);
+	t3=data->sigtime.timediff(ssr->t0[2]);
+
+	/* ssr orbit and clock correction (ref [4]) */
+	if (fabs(t1)>MAXAGESSR||fabs(t2)>MAXAGESSR) {
+		data->svh=-1;
+		return 0;
+	}
+	if (ssr->udi[0]>=1.0) t1-=ssr->udi[0]/2.0;
+	if (ssr->udi[1]>=1.0) t2-=ssr->udi[0]/2.0;
+
+	for (int i=0; i<3; i++) deph[i]=ssr->deph[i]+ssr->ddeph[i]*t1;
+	dclk=ssr->dclk[0]+ssr->dclk[1]*t2+ssr->dclk[2]*t2*t2;
+
+	/* ssr highrate clock correction (ref [4]) */
+	if (ssr->iod[0]==ssr->iod[2]&&ssr->t0[2].time&&fabs(t3)<MAXAGESSR_HRCLK) {
+		dclk+=ssr->hrclk;
+	}
+	if (norm(deph,3)>MAXECORSSR||fabs(dclk)>MAXCCORSSR) {
+		data->svh=-1;
+		return 0;
+	}
+	/* satellite postion and clock by broadcast ephemeris */
+	if (!broadpos(data,ssr->iode,nav)) return 0;
+
+	/* satellite clock for gps, galileo and qzss */
+	sys=satsys(data->sat,NULL);
+	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP) {
+		if ((neph=seleph(data,ssr->iode,nav))<0) return 0;
+
+		/* satellite clock by clock parameters */
+		tk=data->sigtime.timediff(nav->eph[neph].toc);
+		data->dts[0]=nav->eph[neph].f0+nav->eph[neph].f1*tk+nav->eph[neph].f2*tk*tk;
+		data->dts[1]=nav->eph[neph].f1+2.0*nav->eph[neph].f2*tk;
+
+		/* relativity correction */
+		data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
+	}
+	/* radial-along-cross directions in ecef */
+	vec3_t rs(data->posvel),vs(data->posvel+3);
+	if (!normv(vs,ea)) return 0;
+	if (!normv(cross(rs,vs),ec)) {
+		data->svh=-1;
+		return 0;
+	}
+	er=cross(ea,ec);
+
+	/* satellite antenna offset correction */
+	for (int i=0; i<3; i++) {
+		data->posvel[i]+=-(er[i]*deph[0]+ea[i]*deph[1]+ec[i]*deph[2])+dant[i];
+	}
+	/* t_corr = t_sv - (dts(brdc) + dclk(ssr) / CLIGHT) (ref [10] eq.3.12-7) */
+	data->dts[0]+=dclk/CLIGHT;
+
+	/* variance by ssr ura */
+	data->svar=var_urassr(ssr->ura);
+
+	return 1;
+}
+/* broadcast ephemeris with ssr_com correction ---------------------------------------------------- */
+/* Constructors ------------------------------------------------------------------- */
+broadssrcom_t::broadssrcom_t(){
+	batch=0; /* corrections in satpos() */
+}
+broadssrcom_t::~broadssrcom_t(){
+}
+/* base functions ----------------------------------------------------------------- */
+/* broadcast satellite position function with ssr_com correction ------------------ */
+int broadssrcom_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	/* pointer to the ssr_t in nav */
+	const ssr_t *ssr=nav->ssr+data->sat-1;
+	/* satellite system */
+	int sys=satsys(data->sat,NULL);
+	int neph=-1;
+	double t1,t2,t3,deph[3],dclk,dant[3]={ 0 },tk;
+	vec3_t er,ea,ec;
+
+
+	if (!ssr->t0[0].time) {
+		return 0;
+	}
+	if (!ssr->t0[1].time) {
+		return 0;
+	}
+	/* inconsistency between orbit and clock correction */
+	if (ssr->iod[0]!=ssr->iod[1]) {
+		data->svh=-1;
+		return 0;
+	}
+	t1=data->sigtime.timediff(ssr->t0[0]);
+	t2=data->sigtime.timediff(ssr->t0[1]);
+	t3=data->sigtime.timediff(ssr->t0[2]);
+
+	/* ssr orbit and clock correction (ref [4]) */
+	if (fabs(t1)>MAXAGESSR||fabs(t2)>MAXAGESSR) {
+		data->svh=-1;
+		return 0;
+	}
+	if (ssr->udi[0]>=1.0) t1-=ssr->udi[0]/2.0;
+	if (ssr->udi[1]>=1.0) t2-=ssr->udi[0]/2.0;
+
+	for (int i=0; i<3; i++) deph[i]=ssr->deph[i]+ssr->ddeph[i]*t1;
+	dclk=ssr->dclk[0]+ssr->dclk[1]*t2+ssr->dclk[2]*t2*t2;
+
+	/* ssr highrate clock correction (ref [4]) */
+	if (ssr->iod[0]==ssr->iod[2]&&ssr->t0[2].time&&fabs(t3)<MAXAGESSR_HRCLK) {
+		dclk+=ssr->hrclk;
+	}
+	if (norm(deph,3)>MAXECORSSR||fabs(dclk)>MAXCCORSSR) {
+		data->svh=-1;
+		return 0;
+	}
+	/* satellite postion and clock by broadcast ephemeris */
+	if (!broadpos(data,ssr->iode,nav)) return 0;
+
+	/* satellite clock for gps, galileo and qzss */
+	sys=satsys(data->sat,NULL);
+	if (sys==SYS_GPS||sys==SYS_GAL||sys==SYS_QZS||sys==SYS_CMP) {
+		if ((neph=seleph(data,ssr->iode,nav))<0) return 0;
+
+		/* satellite clock by clock parameters */
+		tk=data->sigtime.timediff(nav->eph[neph].toc);
+		data->dts[0]=nav->eph[neph].f0+nav->eph[neph].f1*tk+nav->eph[neph].f2*tk*tk;
+		data->dts[1]=nav->eph[neph].f1+2.0*nav->eph[neph].f2*tk;
+
+		/* relativity correction */
+		data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
+	}
+	/* radial-along-cross directions in ecef */
+	vec3_t rs(data->posvel),vs(data->posvel+3);
+	if (!normv(vs,ea)) return 0;
+	if (!normv(cross(rs,vs),ec)) {
+		data->svh=-1;
+		return 0;
+	}
+	er=cross(ea,ec);
+
+	/* satellite antenna offset correction */
+	satantfunc->satantoff(data,nav);
+
+	for (int i=0; i<3; i++) {
+		data->posvel[i]+=-(er[i]*deph[0]+ea[i]*deph[1]+ec[i]*deph[2]);
+	}
+	/* t_corr = t_sv - (dts(brdc) + dclk(ssr) / CLIGHT) (ref [10] eq.3.12-7) */
+	data->dts[0]+=dclk/CLIGHT;
+
+	/* variance by ssr ura */
+	data->svar=var_urassr(ssr->ura);
+
+	return 1;
+}
+
+/* precise ephemeris ------------------------------------------------------------------------------ */
+/* Constg */
+/* Constructors ------------------------------------------------------------------- */
+preciseph_t::preciseph_t(){
+	double w=1.0;
+
+	/* barycentric weights of uniform epochs: (-1)^j*C(NMAX-1,j) */
+	wbar.resize(NMAX);
+	for (int j=0; j<NMAX; j++) {
+		wbar[j]=j%2 ? -w : w;
+		w=w*(NMAX-1-j)/(j+1);
+	}
+	scvar=0.0;
+}
+preciseph_t::~preciseph_t(){
+}
+/* Implementation functions ------------------------------------------------------- */
+/* base precise ephemeris functions ----------------------------------------------- */
+/* interpolation weights of epochs (barycentric form of Lagrange polynomial) ------
+* args   : double *t       I   time of epochs from interpolation time (s)
+*          int    uni      I   uniform epochs (1: shared weights wbar)
+*          double *w       O   weights of epochs (sum of w is 1)
+* return : none
+* -------------------------------------------------------------------------------- */
+void preciseph_t::interpwgt(const double *t,int uni,double *w) const{
+	double sum=0.0;
+	int i,j;
+
+	for (i=0; i<NMAX; i++) {
+		if (t[i]==0.0) { /* time of epoch */
+			for (j=0; j<NMAX; j++) w[j]=i==j ? 1.0 : 0.0;
+			return;
+		}
+		if (uni) w[i]=wbar[i];
+		else for (j=0,w[i]=1.0; j<NMAX; j++) if (j!=i) w[i]/=t[i]-t[j];
+		sum+=(w[i]/=t[i]);
+	}
+	for (i=0; i<NMAX; i++) w[i]/=sum;
+}
+/* precise satellite position of one epoch -------------------------------------------
+* use 9 orders Lagrange interpolation
+----------------------------------------------------------------------------------- */
+int preciseph_t::precisepos(obsd_t *data,const nav_t *nav){
+	const precstore_t &pe=nav->peph;
+	const double *v[NMAX];
+	const float *sd;
+	double t[NMAX],w[NMAX],c[2],std=0.0,s[3],sinl,cosl,sind=0.0,cosd=1.0,a;
+	int i,j,index;
+
+	data->posvel[0]=data->posvel[1]=data->posvel[2]=data->dts[0]=0.0;
+
+	if (pe.n<NMAX||
+		data->sigtime.timediff(pe.time[0])<-MAXDTE||
+		data->sigtime.timediff(pe.time[pe.n-1])>MAXDTE) {
+		data->errmsg="no percise ephemeris!";
+		return 0;
+	}
+	/* epoch before signal time (direct index of uniform epochs) */
+	index=pe.epoch(data->sigtime);
+
+	/* polynomial interpolation for orbit */
+	i=index+1-(NMAX)/2;
+	if (i<0) i=0; else if (i+NMAX>pe.n) i=pe.n-NMAX;
+
+	for (j=0; j<NMAX; j++) {
+		t[j]=pe.time[i+j].timediff(data->sigtime);
+		if (!(v[j]=pe.value(data->sat,i+j))||norm(v[j],3)<=0.0) {
+			return 0;
+		}
+	}
+	interpwgt(t,pe.tint>0.0,w);
+
+	/* correciton for earh rotation ver.2.4.0 (rotation of next epoch by recurrence) */
+	sinl=sin(OMGE*t[0]); cosl=cos(OMGE*t[0]);
+	if (pe.tint>0.0) { sind=sin(OMGE*pe.tint); cosd=cos(OMGE*pe.tint); }
+	for (j=0; j<NMAX; j++) {
+		if (j>0) {
+			if (pe.tint>0.0) {
+				a=sinl*cosd+cosl*sind; cosl=cosl*cosd-sinl*sind; sinl=a;
+			}
+			else { sinl=sin(OMGE*t[j]); cosl=cos(OMGE*t[j]); }
+		}
+		data->posvel[0]+=w[j]*(cosl*v[j][0]-sinl*v[j][1]);
+		data->posvel[1]+=w[j]*(sinl*v[j][0]+cosl*v[j][1]);
+		data->posvel[2]+=w[j]*v[j][2];
+	}
+
+	/* satellite position variance */
+	sd=pe.stdev(data->sat,index);
+	for (i=0; i<3; i++) s[i]=sd[i];
+	std=norm(s,3);
+	if (t[0]>0.0) std+=EXTERR_EPH*SQR(t[0])/2.0; /* extrapolation error for orbit */
+	else if (t[NMAX-1]<0.0) std+=EXTERR_EPH*SQR(t[NMAX-1])/2.0;
+	data->svar=SQR(std);
+
+	/* linear interpolation for clock */
+	t[0]=data->sigtime.timediff(pe.time[index]);
+	t[1]=data->sigtime.timediff(pe.time[index+1]);
+	c[0]=pe.value(data->sat,index)[3];
+	c[1]=pe.value(data->sat,index+1)[3];
+
+	if (t[0]<=0.0) {
+		if ((data->dts[0]=c[0])!=0.0) {
+			std=pe.stdev(data->sat,index)[3]*CLIGHT-EXTERR_CLK*t[0];
+		}
+	}
+	else if (t[1]>=0.0) {
+		if ((data->dts[0]=c[1])!=0.0) {
+			std=pe.stdev(data->sat,index+1)[3]*CLIGHT+EXTERR_CLK*t[1];
+		}
+	}
+	else if (c[0]!=0.0&&c[1]!=0.0) {
+		data->dts[0]=(c[1]*t[0]-c[0]*t[1])/(t[0]-t[1]);
+		i=t[0]<-t[1] ? 0 : 1;
+		std=pe.stdev(data->sat,index+i)[3]+EXTERR_CLK*fabs(t[i]);
+	}
+	else {
+		data->dts[0]=0.0;
+	}
+	scvar=SQR(std);
+	return 1;
+}
+/* precise satellite clocks function ---------------------------------------------- */
+int preciseph_t::satclk(obsd_t *data,const nav_t *nav){
+	const precstore_t &pc=nav->pclk;
+	const double *c0,*c1;
+	double t[2],c[2],std;
+	int i,index;
+
+	if (pc.n<2||
+		data->sigtime.timediff(pc.time[0])<-MAXDTE||
+		data->sigtime.timediff(pc.time[pc.n-1])>MAXDTE) {
+		data->errmsg="no precise clock!";
+		return 1;
+	}
+	/* epoch before signal time (direct index of uniform epochs) */
+	index=pc.epoch(data->sigtime);
+
+	if (!(c0=pc.value(data->sat,index))||!(c1=pc.value(data->sat,index+1))) {
+		data->errmsg="precise clock outage!";
+		return 0;
+	}
+	/* linear interpolation for clock */
+	t[0]=data->sigtime.timediff(pc.time[index]);
+	t[1]=data->sigtime.timediff(pc.time[index+1]);
+	c[0]=c0[0];
+	c[1]=c1[0];
+
+	if (t[0]<=0.0) {
+		if ((data->dts[0]=c[0])==0.0) return 0;
+		std=pc.stdev(data->sat,index)[0]*CLIGHT-EXTERR_CLK*t[0];
+	}
+	else if (t[1]>=0.0) {
+		if ((data->dts[0]=c[1])==0.0) return 0;
+		std=pc.stdev(data->sat,index+1)[0]*CLIGHT+EXTERR_CLK*t[1];
+	}
+	else if (c[0]!=0.0&&c[1]!=0.0) {
+		data->dts[0]=(c[1]*t[0]-c[0]*t[1])/(t[0]-t[1]);
+		i=t[0]<-t[1] ? 0 : 1;
+		std=pc.stdev(data->sat,index+i)[0]*CLIGHT+EXTERR_CLK*fabs(t[i]);
+	}
+	else {
+		data->errmsg="precise clock outage!";
+		return 0;
+	}
+	scvar=SQR(std);
+	return 1;
+}
+/* precise satellite position function -------------------------------------------- */
+int preciseph_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	double tt=1E-3;
+	int i;
+	/* signal time add 1E-3s */
+	obsd_t data_tt;
+	data_tt.sigtime=data->sigtime;
+	data_tt.sigtime.timeadd(tt);
+	data_tt.sat=data->sat;
+	
+
+	if (data->sat<=0||MAXSAT<data->sat) return 0;
+
+	/* satellite position and clock bias */
+	if (!precisepos(data,nav)||
+		!satclk(data,nav)) return 0;
+
+	if (!precisepos(&data_tt,nav)||
+		!satclk(&data_tt,nav)) return 0;
+
+	/* satellite velocity */
+	for (i=0; i<3; i++) {
+		data->posvel[i+3]=(data_tt.posvel[i]-data->posvel[i])/tt;
+	}
+	/* satellite antenna offset correction */
+	satantfunc->satantoff(data,nav);
+
+	/* relativistic effect correction and satellite clock drift */
+	if (data->dts[0]!=0.0) {
+		data->dts[0]=
+			data->dts[0]-2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
+		data->dts[1]=
+			(data_tt.dts[0]-data->dts[0])/tt;
+	}
+	else { /* no precise clock */
+		data->dts[0]=data->dts[1]=0.0;
+	}
+	data->svar=data->svar+scvar;
+
+	return 1;
+}
+
+/* qzss lex ephemeris ----------------------------------------------------------------------------- */
+/* Consturctors ------------------------------------------------------------------- */
+qzsslex_t::qzsslex_t(){
+}
+qzsslex_t::~qzsslex_t(){
+}
+/* Implementation functions ------------------------------------------------------- */
+/* base functions ----------------------------------------------------------------- */
+/* ura value ---------------------------------------------------------------------- */
+double qzsslex_t::vareph(int ura){
+	const double uraval[]={
+		0.08,0.11,0.15,0.21,0.30,0.43,0.60,0.85,1.20,1.70,2.40,3.40,4.85,6.85,
+		9.65,9.65
+	};
+	if (ura<0||15<ura) ura=15;
+	return uraval[ura];
+}
+/* qzss lex satellite clocks function --------------------------------------------- */
+int qzsslex_t::satclk(obsd_t *data,const nav_t *nav){
+	/* nav->lexeph[data->sat-1] */
+	int sat = data->sat;
+	double dt;
+
+	if (nav->lexeph[sat-1].sat!=sat || nav->lexeph[sat-1].toe.time==0){
+		data->errmsg="no lex ephemeris!";
+		return 0;
+	}
+	if ((dt=data->sigtime.timediff(nav->lexeph[sat-1].toe))>LEXEPHMAXAGE){
+		data->errmsg="lex ephemeris age error!";
+		return 0;
+	}
+#if 0
+	if (nav->lexeph[sat-1].health&0x18) {
+		data->errmsg="lex ephemeris unhealthy!";
+		return 0;
+	}
+#endif
+	data->dts[0]=nav->lexeph[sat-1].af0+nav->lexeph[sat-1].af1*dt;
+	data->dts[1]=nav->lexeph[sat-1].af1;
+
+	return 1;
+}
+/* qzss lex satellite position function ------------------------------------------- */
+int qzsslex_t::satpos(obsd_t *data,int iode,const nav_t *nav){
+	/* nav->lexeph[data->sat-1] */
+	int sat = data->sat;
+	double dt,t2,t3;
+
+	if (nav->lexeph[sat-1].sat!=sat || nav->lexeph[sat-1].toe.time==0){
+		data->errmsg="no lex ephemeris!";
+		return 0;
+	}
+	if ((dt=data->sigtime.timediff(nav->lexeph[sat-1].toe))>LEXEPHMAXAGE){
+		data->errmsg="lex ephemeris age error!";
+		return 0;
+	}
+#if 0
+	if (nav->lexeph[sat-1].health&0x18) {
+		data->errmsg="lex ephemeris unhealthy!";
+		return 0;
+	}
+#endif
+	/* satellite position */
+	t2=dt*dt/2.0; t3=t2*dt/3.0;
+	for (int i=0; i<3; i++) {
+		data->posvel[i]=nav->lexeph[sat-1].pos[i]+nav->lexeph[sat-1].vel[i]*dt +
+			nav->lexeph[sat-1].acc[i]*t2+nav->lexeph[sat-1].jerk[i]*t3;
+		data->posvel[i+3]=nav->lexeph[sat-1].vel[i] +
+			nav->lexeph[sat-1].acc[i]*dt+nav->lexeph[sat-1].jerk[i]*t2;
+	}
+
+	/* satellite clock */
+	data->dts[0]=nav->lexeph[sat-1].af0+nav->lexeph[sat-1].af1*dt;
+	data->dts[1]=nav->lexeph[sat-1].af1;
+
+	/* relativistic effect correction */
+	data->dts[0]-=2.0*dot(data->posvel,data->posvel+3,3)/CLIGHT/CLIGHT;
+
+	data->svar=vareph(nav->lexeph[sat-1].ura);
+
+	return 1;
 }
\ No newline at end of file
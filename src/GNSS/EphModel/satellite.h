@@ -1,160 +1,273 @@
-#ifndef SATELLTIE_H
-#define SATELLTIE_H
-
-#include "GNSS/DataClass/data.h"
-
-#include "GNSS/AntModel/antenna.h"
-
-/* satellite functions ---------------------------------------------------------------------------- */
-/* parent class of satellite functions ------------------------------------------------------------ */
-class satellite_t{
-	/* Constructors */
-	public:
-		satellite_t();
-		virtual ~satellite_t();
-	/* Implementation functions */
-	protected:
-		/* virtual satellite clocks function -------------------------------------- */
-		virtual int satclk(obsd_t *data, const nav_t *nav);
-	public:
-		/* virtual satellite position function ------------------------------------ */
-		virtual int satpos(obsd_t *data, int iode, const nav_t *nav);
-		/* compute satellite positions and clocks --------------------------------- */
-		int satposclk(obs_t *obs, const nav_t *nav);
-	/* Components */
-	public:
-		satantenna_t *satantfunc;		/* satellite antenna functions (point to rtk_t) */
-
-};
- 
-/* subclass of satellite functions ---------------------------------------------------------------- */
-/* broadcast ephemeris ---------------------------------------------------------------------------- */
-class broadcast_t : public satellite_t{
-	/* Constructors */
-	public:
-		broadcast_t();
-		virtual ~broadcast_t();
-	/* Implementation functions */
-	protected:
-		/* broadcast functions ---------------------------------------------------- */
-		/* variance by ura ephemeris (ref [1] 20.3.3.3.1.1) ----------------------- */
-		double var_uraeph(int ura);
-		/* variance by ura ssr (ref [4]) ------------------------------------------ */
-		double var_urassr(int ura);
-		/* glonass orbit differential equations ----------------------------------- */
-		void deq(const double *x,double *xdot,const double *acc);
-		/* glonass position and velocity by numerical integration ----------------- */
-		void glorbit(double t,double *x,const double *acc);
-
-		/* select GPS/GAL/QZS/CMP ephemeris --------------------------------------- */
-		int seleph(obsd_t *data,int iode,const nav_t *nav);
-		/* select GLO ephemeris --------------------------------------------------- */
-		int selgeph(obsd_t *data,int iode,const nav_t *nav);
-		/* select SBS ephemeris --------------------------------------------------- */
-		int selseph(obsd_t *data,const nav_t *nav);
-		/* position functions ----------------------------------------------------- */
-		/* position from GPS/GAL/QZS/CMP ephemeris -------------------------------- */
-		void eph2pos(obsd_t *data, const eph_t eph);
-		/* position bias from GLO ephemeris --------------------------------------- */
-		void geph2pos(obsd_t *data,const geph_t geph);
-		/* position bias from SBS ephemeris --------------------------------------- */
-		void seph2pos(obsd_t *data,const seph_t seph);
-		/* clock functions -------------------------------------------------------- */
-		/* clock bias from GPS/GAL/QZS/CMP ephemeris ------------------------------ */
-		void eph2clk(obsd_t *data,const eph_t eph);
-		/* clock bias from GLO ephemeris ------------------------------------------ */
-		void geph2clk(obsd_t *data,const geph_t geph);
-		/* clock bias from SBS ephemeris ------------------------------------------ */
-		void seph2clk(obsd_t *data,const seph_t seph);
-
-		/* broadcast satellite position function ---------------------------------- */
-		int broadpos(obsd_t *data,int iode,const nav_t *nav);
-		/* broadcast satellite clocks function ------------------------------------ */
-		int satclk(obsd_t *data,const nav_t *nav);
-	public:
-		/* broadcast satellite position function called by satposclk() ------------ */
-		virtual int satpos(obsd_t *data,int iode,const nav_t *nav);
-};
-
-/* broadcast ephemeris with sbas correction ------------------------------------------------------- */
-class broadsbas_t : public broadcast_t{
-	/* Constructors */
-	public:
-		broadsbas_t();
-		~broadsbas_t();
-	/* Implementation functions */
-	protected:
-		/* base functions --------------------------------------------------------------- */
-	public:
-		/* broadcast satellite position function with sbas correction ------------------- */
-		int satpos(obsd_t *data,int iode,const nav_t *nav);
-};
-/* broadcast ephemeris with ssr_apc correction ---------------------------------------------------- */
-class broadssrapc_t : public broadcast_t{
-	/* Constructors */
-	public:
-		broadssrapc_t();
-		~broadssrapc_t();
-	/* Implementation functions */
-	protected:
-		/* base functions --------------------------------------------------------------- */
-	public:
-		/* broadcast satellite position function with ssr_apc correction ---------------- */
-		int satpos(obsd_t *data,int iode,const nav_t *nav);
-};
-/* broadcast ephemeris with ssr_com correction ---------------------------------------------------- */
-class broadssrcom_t : public broadcast_t{
-	/* Constructors */
-	public:
-		broadssrcom_t();
-		~broadssrcom_t();
-	/* Implementation functions */
-	protected:
-		/* base functions --------------------------------------------------------------- */
-	public:
-		/* broadcast satellite position function with ssr_com correction ---------------- */
-		int satpos(obsd_t *data,int iode,const nav_t *nav);
-};
-
-/* precise ephemeris ------------------------------------------------------------------------------ */
-class preciseph_t : public satellite_t{
-	/* Constructors */
-	public:
-		preciseph_t();
-		~preciseph_t();
-	/* Implementation functions */
-	protected:
-		/* base precise ephemeris functions --------------------------------------- */
-		/* polynomial interpolation by Lagrange's algorithm (time interpolation) -- */
-		double interpolLaR(const double *dt, gtime_t *ptime, const double *ppos, 
-			int n);
-		/* precise satellite position of one epoch -------------------------------- */
-		int precisepos(obsd_t *data, const nav_t *nav);
-		/* precise satellite clocks function -------------------------------------- */
-		int satclk(obsd_t *data,const nav_t *nav);
-	public:
-		/* precise satellite position function ------------------------------------ */
-		int satpos(obsd_t *data,int iode,const nav_t *nav);
-	/* Components */
-	protected:
-		double scvar;					/* satellite clock variance */
-};
-
-/* qzss lex ephemeris ----------------------------------------------------------------------------- */
-class qzsslex_t : public satellite_t{
-	/* Constructors */
-	public:
-		qzsslex_t();
-		~qzsslex_t();
-	/* Implementation functions */
-	protected:
-		/* base functions --------------------------------------------------------- */
-		/* ura value -------------------------------------------------------------- */
-		double vareph(int ura);
-		/* qzss lex satellite clocks function ------------------------------------- */
-		int satclk(obsd_t *data,const nav_t *nav);
-	public:
-		/* qzss lex satellite position function ----------------------------------- */
-		int satpos(obsd_t *data,int iode,const nav_t *nav);
-};
+#ifndef SATELLTIE_H
+#define SATELLTIE_H
+
+#include "GNSS/DataClass/data.h"
+
+#include "GNSS/AntModel/antenna.h"
+
+/* per-epoch satellite state cache ---------------------------------------------------------------
+* satellite states computed by satposclk() at transmission time are stored with the ephemeris key
+* (iode) and reused for the same satellite and ephemeris of other receivers (base, other rovers)
+* with transmission time within MAXDTSCACHE, extrapolated by velocity, clock drift and
+* acceleration of orbit. one cache can be set to satellite functions of several rtk_t
+* ------------------------------------------------------------------------------------------------ */
+class satcache_t{
+	/* Constructors */
+	public:
+		satcache_t();
+		~satcache_t();
+	/* Implementation functions */
+	public:
+		/* clear all satellite states --------------------------------------------- */
+		void clear();
+		/* get satellite state at transmission time of observation ------------------
+		* args   : obsd_t *data    IO  observation (sat,sigtime) -> posvel,dts,svar,svh
+		*          int    key      I   ephemeris key (iode, -1: not broadcast)
+		* return : 1: cache hit, 0: no state of satellite and key within window
+		* ------------------------------------------------------------------------- */
+		int get(obsd_t *data,int key);
+		/* set satellite state of observation ------------------------------------- */
+		void set(const obsd_t *data,int key);
+	/* Components */
+	protected:
+		gtime_t time[MAXSAT];			/* transmission time of state */
+		int key[MAXSAT];				/* ephemeris key of state */
+		double posvel[MAXSAT][6];		/* satellite position and velocity (ecef) */
+		double dts[MAXSAT][2];			/* satellite clock bias and drift */
+		double svar[MAXSAT];			/* satellite position and clock variance */
+		int svh[MAXSAT];				/* satellite health flag */
+		lock_t lock;					/* lock of states (shared by rtk_t) */
+	public:
+		unsigned int nhit,nmiss;		/* number of cache hits and misses */
+};
+
+/* block of broadcast ephemerides (structure of arrays of vector lanes) ---------------------------- */
+#define NEPHLANE       8              /* entries of ephemeris block (vector lanes) */
+
+struct ephblk_t{
+	double tk[NEPHLANE],tc[NEPHLANE];	/* time from toe and toc (s) */
+	double A[NEPHLANE],e[NEPHLANE],M0[NEPHLANE],omg[NEPHLANE]; /* kepler elements */
+	double i0[NEPHLANE],idot[NEPHLANE],OMG0[NEPHLANE],OMGd[NEPHLANE],toes[NEPHLANE];
+	double cus[NEPHLANE],cuc[NEPHLANE],crs[NEPHLANE]; /* harmonic correction terms */
+	double crc[NEPHLANE],cis[NEPHLANE],cic[NEPHLANE];
+	double f0[NEPHLANE],f1[NEPHLANE],f2[NEPHLANE]; /* clock parameters */
+	double n0[NEPHLANE];				/* corrected mean motion (rad/s) */
+	double sqe[NEPHLANE];				/* sqrt(1-e^2) */
+	double frel[NEPHLANE];				/* relativity factor of clock (s) */
+	double omge[NEPHLANE];				/* earth rotation rate (rad/s) */
+	double geo[NEPHLANE];				/* beidou geo (1/0) */
+	double x[NEPHLANE],y[NEPHLANE],z[NEPHLANE]; /* satellite position (ecef) */
+	double dts[NEPHLANE];				/* satellite clock bias (s) */
+};
+
+/* broadcast ephemerides of epoch ------------------------------------------------------------------
+* selected GPS/GAL/QZS/CMP ephemerides and transmission times of all satellites of an epoch,
+* kepler orbits and clocks of all entries are computed in one vectorized pass (AVX-512/AVX2)
+* entry i is lane i%NEPHLANE of block i/NEPHLANE, unused lanes of last block are zero
+* ------------------------------------------------------------------------------------------------ */
+class ephbatch_t{
+	/* Constructors */
+	public:
+		ephbatch_t();
+		~ephbatch_t();
+	/* Implementation functions */
+	public:
+		/* clear entries (capacity is kept) --------------------------------------- */
+		void clear();
+		/* add ephemeris at transmission time ---------------------------------------
+		* args   : eph_t  &eph     I   broadcast ephemeris (A>0)
+		*          gtime_t time    I   transmission time (gpst)
+		*          int    ref      I   reference of entry (caller data)
+		* return : index of entry ------------------------------------------------ */
+		int add(const eph_t &eph,gtime_t time,int ref);
+		/* positions and clocks of all entries -------------------------------------
+		* fixed-iteration kepler solver, harmonic corrections, beidou geo rotation
+		* and relativity correction of clock (same model as broadcast_t::eph2pos)
+		* ------------------------------------------------------------------------- */
+		void eph2pos();
+	/* Components */
+	public:
+		int n;							/* number of entries */
+		vector<const eph_t *> eph;		/* ephemeris of entry */
+		vector<int> ref;				/* reference of entry */
+		vector<ephblk_t> blk;			/* blocks of entries (capacity) */
+};
+
+/* integrated glonass orbit of satellite ----------------------------------------------------------
+* state of last integration on TSTEP grid from toe of ephemeris, next integration of the same
+* ephemeris continues from the state (cost per epoch independent of |t-toe|)
+* ------------------------------------------------------------------------------------------------ */
+struct glostate_t{
+	gtime_t toe;						/* toe of ephemeris (toe.time=0: no state) */
+	int iode;							/* iode of ephemeris */
+	double pos0[3];						/* position of ephemeris at toe (ecef) */
+	double tg;							/* time from toe of state (multiple of TSTEP) (s) */
+	double x[6];						/* position and velocity of state (ecef) */
+};
+
+/* satellite functions ---------------------------------------------------------------------------- */
+/* parent class of satellite functions ------------------------------------------------------------ */
+class satellite_t{
+	/* Constructors */
+	public:
+		satellite_t();
+		virtual ~satellite_t();
+	/* Implementation functions */
+	protected:
+		/* virtual satellite clocks function -------------------------------------- */
+		virtual int satclk(obsd_t *data, const nav_t *nav);
+	public:
+		/* virtual satellite position function ------------------------------------ */
+		virtual int satpos(obsd_t *data, int iode, const nav_t *nav);
+		/* compute satellite positions and clocks --------------------------------- */
+		virtual int satposclk(obs_t *obs, const nav_t *nav);
+	/* Components */
+	public:
+		satantenna_t *satantfunc;		/* satellite antenna functions (point to rtk_t) */
+		satcache_t *cache;				/* satellite state cache (point to rtk_t, NULL: no cache) */
+	protected:
+		int iode;						/* ephemeris key of last satclk() (-1: not broadcast) */
+
+};
+ 
+/* subclass of satellite functions ---------------------------------------------------------------- */
+/* broadcast ephemeris ---------------------------------------------------------------------------- */
+class broadcast_t : public satellite_t{
+	/* Constructors */
+	public:
+		broadcast_t();
+		virtual ~broadcast_t();
+	/* Implementation functions */
+	protected:
+		/* broadcast functions ---------------------------------------------------- */
+		/* variance by ura ephemeris (ref [1] 20.3.3.3.1.1) ----------------------- */
+		double var_uraeph(int ura);
+		/* variance by ura ssr (ref [4]) ------------------------------------------ */
+		double var_urassr(int ura);
+		/* glonass orbit differential equations ----------------------------------- */
+		void deq(const double *x,double *xdot,const double *acc);
+		/* glonass position and velocity by numerical integration ----------------- */
+		void glorbit(double t,double *x,const double *acc);
+		/* integrated glonass state at grid point before time from toe ----------- */
+		double glostate(int sat,const geph_t &geph,double t,double *x);
+
+		/* select GPS/GAL/QZS/CMP ephemeris --------------------------------------- */
+		int seleph(obsd_t *data,int iode,const nav_t *nav);
+		/* select GLO ephemeris --------------------------------------------------- */
+		int selgeph(obsd_t *data,int iode,const nav_t *nav);
+		/* select SBS ephemeris --------------------------------------------------- */
+		int selseph(obsd_t *data,const nav_t *nav);
+		/* position functions ----------------------------------------------------- */
+		/* position from GPS/GAL/QZS/CMP ephemeris -------------------------------- */
+		void eph2pos(obsd_t *data,const eph_t &eph);
+		/* position and velocity from GLO ephemeris ------------------------------- */
+		void geph2pos(obsd_t *data,const geph_t &geph);
+		/* position bias from SBS ephemeris --------------------------------------- */
+		void seph2pos(obsd_t *data,const seph_t &seph);
+		/* clock functions -------------------------------------------------------- */
+		/* clock bias from GPS/GAL/QZS/CMP ephemeris ------------------------------ */
+		void eph2clk(obsd_t *data,const eph_t &eph);
+		/* clock bias from GLO ephemeris ------------------------------------------ */
+		void geph2clk(obsd_t *data,const geph_t &geph);
+		/* clock bias from SBS ephemeris ------------------------------------------ */
+		void seph2clk(obsd_t *data,const seph_t &seph);
+
+		/* broadcast satellite position function ---------------------------------- */
+		int broadpos(obsd_t *data,int iode,const nav_t *nav);
+		/* broadcast satellite clocks function ------------------------------------ */
+		int satclk(obsd_t *data,const nav_t *nav);
+	public:
+		/* broadcast satellite position function called by satposclk() ------------ */
+		virtual int satpos(obsd_t *data,int iode,const nav_t *nav);
+		/* compute satellite positions and clocks (kepler orbits in batch) -------- */
+		virtual int satposclk(obs_t *obs,const nav_t *nav);
+	/* Components */
+	public:
+		int batch;						/* kepler orbits of epoch in batch (0: by satpos()) */
+	protected:
+		ephbatch_t ephb;				/* ephemerides of epoch for batch */
+		glostate_t glost[MAXSAT];		/* integrated glonass orbits */
+};
+
+/* broadcast ephemeris with sbas correction ------------------------------------------------------- */
+class broadsbas_t : public broadcast_t{
+	/* Constructors */
+	public:
+		broadsbas_t();
+		~broadsbas_t();
+	/* Implementation functions */
+	protected:
+		/* base functions --------------------------------------------------------------- */
+	public:
+		/* broadcast satellite position function with sbas correction ------------------- */
+		int satpos(obsd_t *data,int iode,const nav_t *nav);
+};
+/* broadcast ephemeris with ssr_apc correction ---------------------------------------------------- */
+class broadssrapc_t : public broadcast_t{
+	/* Constructors */
+	public:
+		broadssrapc_t();
+		~broadssrapc_t();
+	/* Implementation functions */
+	protected:
+		/* base functions --------------------------------------------------------------- */
+	public:
+		/* broadcast satellite position function with ssr_apc correction ---------------- */
+		int satpos(obsd_t *data,int iode,const nav_t *nav);
+};
+/* broadcast ephemeris with ssr_com correction ---------------------------------------------------- */
+class broadssrcom_t : public broadcast_t{
+	/* Constructors */
+	public:
+		broadssrcom_t();
+		~broadssrcom_t();
+	/* Implementation functions */
+	protected:
+		/* base functions --------------------------------------------------------------- */
+	public:
+		/* broadcast satellite position function with ssr_com correction ---------------- */
+		int satpos(obsd_t *data,int iode,const nav_t *nav);
+};
+
+/* precise ephemeris ------------------------------------------------------------------------------ */
+class preciseph_t : public satellite_t{
+	/* Constructors */
+	public:
+		preciseph_t();
+		~preciseph_t();
+	/* Implementation functions */
+	protected:
+		/* base precise ephemeris functions --------------------------------------- */
+		/* interpolation weights of epochs (barycentric form of lagrange) -------- */
+		void interpwgt(const double *t,int uni,double *w) const;
+		/* precise satellite position of one epoch -------------------------------- */
+		int precisepos(obsd_t *data, const nav_t *nav);
+		/* precise satellite clocks function -------------------------------------- */
+		int satclk(obsd_t *data,const nav_t *nav);
+	public:
+		/* precise satellite position function ------------------------------------ */
+		int satpos(obsd_t *data,int iode,const nav_t *nav);
+	/* Components */
+	protected:
+		double scvar;					/* satellite clock variance */
+		vector<double> wbar;			/* barycentric weights of uniform epochs */
+};
+
+/* qzss lex ephemeris ----------------------------------------------------------------------------- */
+class qzsslex_t : public satellite_t{
+	/* Constructors */
+	public:
+		qzsslex_t();
+		~qzsslex_t();
+	/* Implementation functions */
+	protected:
+		/* base functions --------------------------------------------------------- */
+		/* ura value -------------------------------------------------------------- */
+		double vareph(int ura);
+		/* qzss lex satellite clocks function ------------------------------------- */
+		int satclk(obsd_t *data,const nav_t *nav);
+	public:
+		/* qzss lex satellite position function ----------------------------------- */
+		int satpos(obsd_t *data,int iode,const nav_t *nav);
+};
 #endif
\ No newline at end of file
@@ -129,8 +129,8 @@ class inrnxN_t : public inrnx_t{
 		int decode_seph(gtime_t toc,int sat,seph_t *seph);
 		/* decode ephemeris ------------------------------------------------------- */
 		int decode_eph(gtime_t toc,int sat,eph_t *eph);
-		/* add data to nav_t ------------------------------------------------------ */
-		void addnav(int sys,nav_t *nav);
+		/* decode ephemeris and add to nav_t (per-satellite index updated) -------- */
+		void addnav(int sys,gtime_t toc,int sat,nav_t *nav);
 		/* read "O" file to obs_t vector ------------------------------------------ */
 		int readrnxnavb(nav_t *nav);
 	public:
@@ -0,0 +1,78 @@
+/* Decoder throughput and matmul kernel benchmark ---------------------------------------------------
+* benchmain [nepoch [tmin [nthread]]]
+*   nepoch : number of simulated epochs (1 Hz, default 3600)
+*   tmin   : minimum decoding time of each stream (s, default 0.5)
+*   nthread: number of threads of parallel log decoding (default 0:number of cpus)
+--------------------------------------------------------------------------------------------------- */
+#include "Decode/decbench.h"
+#include "BaseFunction/basefunction.h"
+
+/* matmul kernel benchmark ---------------------------------------------------------------------------
+* matmul_pnt() against the plain loop of matmul() for square matrices of filter sizes, each case is
+* run in batches of calls until minimum time
+*-------------------------------------------------------------------------------------------------- */
+static void matbench(FILE *fp,double tmin){
+	const int size[]={ 8,16,32,64,128,256 };
+	const char *tra[]={ "NN","NT","TN","TT" };
+	vector<double> A,B,C,R;
+	unsigned long long t0;
+	double t[2],err,flop;
+	int i,j,k,m,n,nrep;
+
+	fprintf(fp,"%-16s %6s %9s %9s %8s %9s\n","matmul","size","GFLOP/s","loop","speedup",
+		"maxerr");
+	for (i=0; i<(int)(sizeof(size)/sizeof(int)); i++) {
+		n=size[i];
+		A.resize(n*n); B.resize(n*n); C.assign(n*n,0.0); R.assign(n*n,0.0);
+		for (k=0; k<n*n; k++) { A[k]=sin(k*0.37); B[k]=cos(k*0.11); }
+		flop=2.0*n*n*n;
+		for (j=0; j<4; j++) {
+			for (k=0; k<2; k++) {
+				nrep=0; t0=tickget_ns();
+				do {
+					for (m=0; m<16; m++) {
+						if (k==0) matmul_pnt(tra[j],n,n,n,1.0,&A[0],&B[0],0.0,&C[0]);
+						else matmul(tra[j],n,n,n,1.0,&A[0],&B[0],0.0,&R[0]);
+					}
+					nrep+=16;
+				} while ((t[k]=(tickget_ns()-t0)*1E-9)<tmin);
+				t[k]/=nrep;
+			}
+			for (k=0,err=0.0; k<n*n; k++) if (fabs(C[k]-R[k])>err) err=fabs(C[k]-R[k]);
+			fprintf(fp,"%-16s %6d %9.2f %9.2f %8.1f %9.1E\n",("matmul "+string(tra[j])).c_str(),
+				n,flop/t[0]*1E-9,flop/t[1]*1E-9,t[1]/t[0],err);
+		}
+	}
+}
+
+int benchmain(int argc,char* argv[]){
+	decbench_t bench;
+	gtime_t ts;
+	double tow;
+	int week,nepoch=argc>1 ? atoi(argv[1]) : 3600;
+	double tmin=argc>2 ? atof(argv[2]) : 0.5;
+	int nthread=argc>3 ? atoi(argv[3]) : 0;
+	long long nbyte;
+
+	/* start at current hour (1042 decoder checks bdt week against cpu time) */
+	tow=ts.timeget()->utc2gpst()->time2gpst(&week);
+	ts.gpst2time(week,floor(tow/3600.0)*3600.0);
+
+	nbyte=bench.genstreams(ts,1.0,nepoch);
+	cout << "generated " << bench.str.size() << " streams (" << nbyte << " bytes)\n";
+
+	bench.run(tmin);
+	bench.report(stdout);
+
+	/* serial and parallel decoding of receiver logs */
+	fprintf(stdout,"\n");
+	if (!bench.logcheck(stdout,nthread)) {
+		cout << "parallel log decoding differs from serial decoding\n";
+		return 0;
+	}
+	/* matmul kernels (8 cases per size in decoding time of one stream) */
+	fprintf(stdout,"\n");
+	matbench(stdout,tmin/8.0);
+
+	return 1;
+}